@@ -259,6 +259,73 @@ sx_status_t sx_api_fdb_uc_mac_addr_get(const sx_api_handle_t              handle
                                        sx_fdb_uc_mac_addr_params_t       *mac_list_p,
                                        uint32_t                          *data_cnt_p);
 
+/**
+ * This function creates/destroys a snapshot of the UC MAC entries of the SW FDB table.
+ * Command CREATE takes a copy-on-write snapshot of the entries of type mac_type which
+ * match key_filter_p (FID/MAC/logical port), returns its ID in snapshot_id_p and the
+ * number of entries it holds in data_cnt_p.
+ * The snapshot is consistent as of its creation time. Learning, aging and
+ * sx_api_fdb_uc_mac_addr_set keep running while it exists; entries they modify are
+ * copied on first modification, so that the snapshot is not affected.
+ * Command DESTROY releases the snapshot given in snapshot_id_p. A snapshot is
+ * destroyed implicitly when the handle which created it is closed.
+ *
+ *  Supported devices: Spectrum.
+ *
+ * @param[in] handle            - SX-API handle
+ * @param[in] cmd               - CREATE/DESTROY
+ * @param[in] swid              - virtual switch partition ID. Applicable only for command CREATE
+ * @param[in] mac_type          - static, dynamic, all. Applicable only for command CREATE
+ * @param[in] key_filter_p      - filter types - FID/MAC/logical port (may be NULL).
+ *                                Applicable only for command CREATE
+ * @param[in,out] snapshot_id_p - snapshot ID. Returned on CREATE, given on DESTROY
+ * @param[out] data_cnt_p       - number of entries in the snapshot (may be NULL)
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully
+ * @return SX_STATUS_INVALID_HANDLE if a NULL handle is received
+ * @return SX_STATUS_CMD_UNSUPPORTED if command is not supported
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if a parameter exceeds its range
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL
+ * @return SX_STATUS_ENTRY_NOT_FOUND if the snapshot does not exist
+ * @return SX_STATUS_NO_RESOURCES if no more snapshots can be created
+ * @return SX_STATUS_ERROR for a general error
+ */
+sx_status_t sx_api_fdb_uc_mac_addr_snapshot_set(const sx_api_handle_t            handle,
+                                                const sx_access_cmd_t            cmd,
+                                                const sx_swid_t                  swid,
+                                                const sx_fdb_uc_mac_entry_type_t mac_type,
+                                                const sx_fdb_uc_key_filter_t    *key_filter_p,
+                                                uint32_t                        *snapshot_id_p,
+                                                uint32_t                        *data_cnt_p);
+
+/**
+ * This function reads the next page of MAC entries from a snapshot created by
+ * sx_api_fdb_uc_mac_addr_snapshot_set.
+ * Unlike sx_api_fdb_uc_mac_addr_get, the number of entries per call is not limited by
+ * SX_FDB_MAX_GET_ENTRIES; it is bounded only by the size of mac_list_p. Reading a
+ * snapshot does not block other FDB operations.
+ * When all entries were read, *data_cnt_p is set to the number of entries returned in
+ * the last page (possibly 0), and SX_STATUS_ENTRY_NOT_FOUND is returned on any further call.
+ *
+ *  Supported devices: Spectrum.
+ *
+ * @param[in] handle         - SX-API handle
+ * @param[in] snapshot_id    - snapshot ID returned by sx_api_fdb_uc_mac_addr_snapshot_set
+ * @param[out] mac_list_p    - pointer to list
+ * @param[in,out] data_cnt_p - size of mac_list_p, also retrieved number of entries
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully
+ * @return SX_STATUS_INVALID_HANDLE if a NULL handle is received
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if *data_cnt_p is 0
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL
+ * @return SX_STATUS_ENTRY_NOT_FOUND if the snapshot does not exist or has no more entries
+ * @return SX_STATUS_ERROR for a general error
+ */
+sx_status_t sx_api_fdb_uc_mac_addr_snapshot_get(const sx_api_handle_t        handle,
+                                                const uint32_t               snapshot_id,
+                                                sx_fdb_uc_mac_addr_params_t *mac_list_p,
+                                                uint32_t                    *data_cnt_p);
+
 /**
  * This function counts all MAC entries in the SW FDB table (static and dynamic).
  *
@@ -326,6 +393,65 @@ sx_status_t sx_api_fdb_uc_fid_count_get(const sx_api_handle_t handle,
                                         const sx_fid_t        fid,
                                         uint32_t             *data_cnt_p);
 
+/**
+ * This function retrieves the amount of MACs learned on a list of ports (static and
+ * dynamic) in a single call.
+ * data_cnt_list_p[i] returns the amount of MACs learned on log_port_list_p[i], as
+ * sx_api_fdb_uc_port_count_get, and status_list_p[i] the result for that port.
+ *
+ * Supported devices: Spectrum.
+ *
+ * @param[in] handle           - SX-API handle
+ * @param[in] log_port_list_p  - list of logical port IDs
+ * @param[out] data_cnt_list_p - list of retrieved number of entries
+ * @param[out] status_list_p   - per-port operation status
+ * @param[in] port_cnt         - number of ports in the lists
+ *
+ * @return SX_STATUS_SUCCESS if all ports were read successfully
+ * @return SX_STATUS_PARTIALLY_COMPLETE if some of the ports were not found
+ * @return SX_STATUS_INVALID_HANDLE for an invalid handle
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if port_cnt is 0 or exceeds range
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL
+ * @return SX_STATUS_ERROR for a general error
+ */
+sx_status_t sx_api_fdb_uc_port_count_bulk_get(const sx_api_handle_t   handle,
+                                              const sx_port_log_id_t *log_port_list_p,
+                                              uint32_t               *data_cnt_list_p,
+                                              sx_status_t            *status_list_p,
+                                              const uint32_t          port_cnt);
+
+/**
+ * This function retrieves the amount of MACs learned on a list of FIDs (static and
+ * dynamic) in a single call.
+ * data_cnt_list_p[i] returns the amount of MACs learned on fid_list_p[i], as
+ * sx_api_fdb_uc_fid_count_get, and status_list_p[i] the result for that FID.
+ *
+ *  When in 802.1D mode, instead of providing a fid (filtering ID),
+ *  you should provide a bridge_id.
+ *
+ * Supported devices: Spectrum.
+ *
+ * @param[in] handle           - SX-API handle
+ * @param[in] swid             - virtual switch partition ID
+ * @param[in] fid_list_p       - list of filtering DB IDs
+ * @param[out] data_cnt_list_p - list of retrieved number of entries
+ * @param[out] status_list_p   - per-FID operation status
+ * @param[in] fid_cnt          - number of FIDs in the lists
+ *
+ * @return SX_STATUS_SUCCESS if all FIDs were read successfully
+ * @return SX_STATUS_PARTIALLY_COMPLETE if some of the FIDs were not found
+ * @return SX_STATUS_INVALID_HANDLE for an invalid handle
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if fid_cnt is 0 or exceeds range, or SWID is out of range
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL
+ * @return SX_STATUS_ERROR for a general error
+ */
+sx_status_t sx_api_fdb_uc_fid_count_bulk_get(const sx_api_handle_t handle,
+                                             const sx_swid_t       swid,
+                                             const sx_fid_t       *fid_list_p,
+                                             uint32_t             *data_cnt_list_p,
+                                             sx_status_t          *status_list_p,
+                                             const uint32_t        fid_cnt);
+
 /**
  * This function sets/removes the limit on the amount of dynamic MACs learned on a port.
  *
@@ -429,6 +555,73 @@ sx_status_t sx_api_fdb_uc_limit_fid_get(const sx_api_handle_t handle,
                                         const sx_fid_t        fid,
                                         uint32_t             *limit_p);
 
+/**
+ * This function sets the threshold notification parameters of the dynamic MAC limits
+ * set by sx_api_fdb_uc_limit_port_set and sx_api_fdb_uc_limit_fid_set.
+ *
+ * For every port and FID of the swid which has a limit, the SDK compares the amount of
+ * dynamic MACs learned on it with the thresholds in threshold_params_p, given in
+ * percentage of the limit (e.g. 80% and 95%). Static MACs are not counted, as they are
+ * not counted by the limit either. A port or FID whose limit is 0 learns no dynamic MAC,
+ * and generates no event.
+ * When the amount rises to a threshold, a threshold crossing event is sent; when it
+ * falls below the threshold minus threshold_params_p->hysteresis percent, a clear event
+ * is sent. No further event is
+ * sent for the same threshold until the opposite crossing happens, so a count which
+ * oscillates around a threshold does not generate a flood of events.
+ * Events are sent with trap ID SX_TRAP_ID_FDB_LIMIT_THRESHOLD, and can be read with
+ * sx_lib_host_ifc_recv_list on a file descriptor registered to this trap ID.
+ * An empty threshold list disables the notifications.
+ *
+ * threshold_params_p (sx_fdb_limit_threshold_params_t) holds:
+ *  - threshold_cnt  - number of thresholds, 0 to SX_FDB_LIMIT_THRESHOLDS_MAX (4)
+ *  - threshold_list - thresholds in percent of the limit, 1 to 100, in increasing order
+ *  - hysteresis     - in percent of the limit, lower than the smallest threshold
+ * Each event (sx_fdb_limit_threshold_event_t, in receive_info->event_info.fdb_limit)
+ * holds:
+ *  - type       - SX_FDB_LIMIT_THRESHOLD_EVENT_CROSSED or SX_FDB_LIMIT_THRESHOLD_EVENT_CLEARED
+ *  - key_type   - SX_FDB_LIMIT_KEY_PORT or SX_FDB_LIMIT_KEY_FID
+ *  - log_port   - port whose count crossed the threshold. Valid for SX_FDB_LIMIT_KEY_PORT
+ *  - fid        - FID whose count crossed the threshold. Valid for SX_FDB_LIMIT_KEY_FID
+ *  - threshold  - threshold crossed, in percent
+ *  - mac_cnt    - amount of dynamic MACs learned when the event was generated
+ *  - limit      - limit of the port or FID
+ *
+ *  Supported devices: Spectrum.
+ *
+ * @param[in] handle              - SX-API handle
+ * @param[in] swid                - virtual switch partition ID
+ * @param[in] threshold_params_p  - thresholds and hysteresis
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully
+ * @return SX_STATUS_INVALID_HANDLE for an invalid handle
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if a threshold or the hysteresis is out of range
+ * @return SX_STATUS_ERROR for a general error
+ */
+sx_status_t sx_api_fdb_uc_limit_threshold_set(const sx_api_handle_t                  handle,
+                                              const sx_swid_t                        swid,
+                                              const sx_fdb_limit_threshold_params_t *threshold_params_p);
+
+/**
+ * This function retrieves the threshold notification parameters of the dynamic MAC limits.
+ *
+ *  Supported devices: Spectrum.
+ *
+ * @param[in] handle              - SX-API handle
+ * @param[in] swid                - virtual switch partition ID
+ * @param[out] threshold_params_p - thresholds and hysteresis
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully
+ * @return SX_STATUS_INVALID_HANDLE for an invalid handle
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if the SWID is out of range
+ * @return SX_STATUS_ERROR for a general error
+ */
+sx_status_t sx_api_fdb_uc_limit_threshold_get(const sx_api_handle_t            handle,
+                                              const sx_swid_t                  swid,
+                                              sx_fdb_limit_threshold_params_t *threshold_params_p);
+
 /**
  *      This function adds/deletes MC MAC entries from the FDB.
  *      Note: MC entries cannot be created and associated with ports at the same time.
@@ -616,6 +809,10 @@ sx_status_t sx_api_fdb_mc_mac_addr_iter_get(const sx_api_handle_t         handle
  * When in 802.1D mode, instead of providing a vid (Vlan ID),
  * you should provide a bridge_id.
  *
+ * The mc container id in data must be a container created by sx_api_mc_container_set.
+ * Multicast containers owned by the SDK (see sx_api_fdb_mc_mac_addr_group_port_set)
+ * cannot be used, and return SX_STATUS_PARAM_ERROR.
+ *
  * Supported devices: Spectrum.
  *
  * @param[in] handle           - SX-API handle
@@ -639,6 +836,90 @@ sx_status_t sx_api_fdb_mc_mac_addr_group_set(const sx_api_handle_t     handle,
                                              const sx_fdb_mac_key_t  * group_key,
                                              const sx_fdb_mac_data_t * data);
 
+/**
+ * This function adds/deletes a list of MC MAC entries in the FDB in a single call.
+ * Each entry i is handled exactly as by sx_api_fdb_mc_mac_addr_group_set with the same
+ * cmd, with group_key_list_p[i] and data_list_p[i].
+ * Entries are processed in list order. A failure on one entry does not stop the
+ * processing of the following entries; the result of every entry is returned in
+ * status_list_p[i].
+ * On return, *group_cnt_p holds the number of entries which were programmed successfully.
+ *
+ * Supported devices: Spectrum.
+ *
+ * @param[in] handle           - SX-API handle
+ * @param[in] cmd              - add/delete
+ * @param[in] group_key_list_p - list of {fid, mac} keys for multicast
+ * @param[in] data_list_p      - list of fdb data including action and mc container id.
+ *                               Ignored for delete (may be NULL)
+ * @param[out] status_list_p   - per-entry operation status
+ * @param[in,out] group_cnt_p  - number of entries in the lists, also number of entries
+ *                               programmed successfully
+ *
+ * @return SX_STATUS_SUCCESS if all entries were programmed successfully
+ * @return SX_STATUS_PARTIALLY_COMPLETE if some of the entries failed
+ * @return SX_STATUS_INVALID_HANDLE if a NULL handle is received
+ * @return SX_STATUS_CMD_UNSUPPORTED if command is not supported
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if a parameter exceeds its range
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL
+ * @return SX_STATUS_ERROR for a general error
+ */
+sx_status_t sx_api_fdb_mc_mac_addr_group_bulk_set(const sx_api_handle_t    handle,
+                                                  const sx_access_cmd_t    cmd,
+                                                  const sx_fdb_mac_key_t  *group_key_list_p,
+                                                  const sx_fdb_mac_data_t *data_list_p,
+                                                  sx_status_t             *status_list_p,
+                                                  uint32_t                *group_cnt_p);
+
+/**
+ * This function adds/deletes a port to/from the port list of a set of MC MAC entries.
+ * Entries updated by this function are moved to multicast containers owned by the SDK,
+ * one per distinct port list. For every distinct port list among the given groups, the
+ * SDK computes the new port list once:
+ *  - if the entry uses a container created by the caller with sx_api_mc_container_set,
+ *    the entry is moved to the SDK-owned container of the new port list. The caller's
+ *    container is never modified nor destroyed by this function,
+ *  - if all the entries using an SDK-owned container are in the set, and no SDK-owned
+ *    container with the new port list exists, the container is updated in place,
+ *  - otherwise the given entries are moved to the SDK-owned container of the new port
+ *    list, which is created if no entry uses this port list yet. When all the entries of
+ *    a container move, the two containers are thus merged.
+ * SDK-owned containers no longer used by any entry are destroyed.
+ * Hence the HW cost of the update is one container write per distinct port list, plus one
+ * FDB entry write per entry which moved to another container. Entries which are updated
+ * in place cost no FDB entry write. Once all the entries with the same port list are on
+ * one SDK-owned container, later updates of the whole set are done in place.
+ * SDK-owned containers are reported by sx_api_fdb_mc_mac_addr_group_get, but they cannot
+ * be referenced by the caller: using them in sx_api_mc_container_set, in MC routes or in
+ * other FDB entries returns SX_STATUS_PARAM_ERROR. Setting the entry again with
+ * sx_api_fdb_mc_mac_addr_group_set moves it back to a caller-owned container.
+ * Adding a port which is already in the port list of an entry, or deleting a port which is
+ * not, leaves that entry unchanged.
+ * Entries given here must use a multicast container as destination.
+ *
+ * Supported devices: Spectrum.
+ *
+ * @param[in] handle           - SX-API handle
+ * @param[in] cmd              - add/delete
+ * @param[in] group_key_list_p - list of {fid, mac} keys for multicast
+ * @param[in] group_cnt        - number of entries in group_key_list_p
+ * @param[in] log_port         - logical port to add/delete
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully
+ * @return SX_STATUS_INVALID_HANDLE if a NULL handle is received
+ * @return SX_STATUS_CMD_UNSUPPORTED if command is not supported
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if a parameter exceeds its range
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL
+ * @return SX_STATUS_ENTRY_NOT_FOUND if a group does not exist
+ * @return SX_STATUS_NO_RESOURCES if no multicast container is available to create
+ * @return SX_STATUS_ERROR for a general error
+ */
+sx_status_t sx_api_fdb_mc_mac_addr_group_port_set(const sx_api_handle_t   handle,
+                                                  const sx_access_cmd_t   cmd,
+                                                  const sx_fdb_mac_key_t *group_key_list_p,
+                                                  const uint32_t          group_cnt,
+                                                  const sx_port_log_id_t  log_port);
+
 
 /**
  * This function get MC MAC entries from the FDB.
@@ -748,6 +1029,84 @@ sx_status_t sx_api_fdb_uc_flush_port_fid_set(const sx_api_handle_t  handle,
                                              const sx_port_log_id_t log_port,
                                              const sx_fid_t         fid);
 
+/**
+ *  This function starts/cancels a background flush of FDB UC table entries.
+ *  Command CREATE starts a flush job of the entries of swid that match key_filter_p,
+ *  and returns its ID in job_id_p. If key_filter_p is NULL, all entries of swid are
+ *  flushed, as by sx_api_fdb_uc_flush_all_set; a filter on FID, on logical port, or
+ *  on both flushes the same entries as sx_api_fdb_uc_flush_fid_set,
+ *  sx_api_fdb_uc_flush_port_set and sx_api_fdb_uc_flush_port_fid_set.
+ *  The call returns immediately. The job deletes at most slice_size entries at a
+ *  time, and lets other FDB operations run between slices, so learning and
+ *  sx_api_fdb_uc_mac_addr_set keep making progress while the flush runs. An entry
+ *  learned after the job started is not flushed by it.
+ *  A progress event is sent after each slice, and a completion event when the job
+ *  ends, both with trap ID SX_TRAP_ID_FDB_FLUSH_JOB, and can be read with
+ *  sx_lib_host_ifc_recv_list on a file descriptor registered to this trap ID.
+ *  Each event (sx_fdb_flush_job_event_t, in receive_info->event_info.fdb_flush_job) holds
+ *  the uint32_t fields job_id, flushed_cnt and remaining_cnt, and the boolean_t field
+ *  done, with the meaning of the outputs of sx_api_fdb_uc_flush_job_get.
+ *  Command DESTROY cancels the job given in job_id_p if it is still running, and
+ *  releases its state; entries already flushed are not restored. No completion event
+ *  is sent for a job cancelled by DESTROY.
+ *  A job belongs to the handle which created it. When that handle is closed by
+ *  sx_api_close, its running jobs are cancelled and the state of all its jobs is released.
+ *
+ *  Supported devices: Spectrum.
+ *
+ * @param[in] handle        - SX-API handle
+ * @param[in] cmd           - CREATE/DESTROY
+ * @param[in] swid          - virtual switch partition ID. Applicable only for command CREATE
+ * @param[in] key_filter_p  - FID/logical port filter (may be NULL). Applicable only for command CREATE
+ * @param[in] slice_size    - maximum number of entries deleted per slice. Applicable only for command CREATE
+ * @param[in,out] job_id_p  - flush job ID. Returned on CREATE, given on DESTROY
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully
+ * @return SX_STATUS_INVALID_HANDLE if a NULL handle is received
+ * @return SX_STATUS_CMD_UNSUPPORTED if command is not supported
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if a parameter exceeds its range
+ * @return SX_STATUS_ENTRY_NOT_FOUND if the job does not exist
+ * @return SX_STATUS_NO_RESOURCES if there is no place in the jobs buffer
+ * @return SX_STATUS_ERROR for a general error
+ */
+sx_status_t sx_api_fdb_uc_flush_job_set(const sx_api_handle_t         handle,
+                                        const sx_access_cmd_t         cmd,
+                                        const sx_swid_t               swid,
+                                        const sx_fdb_uc_key_filter_t *key_filter_p,
+                                        const uint32_t                slice_size,
+                                        uint32_t                     *job_id_p);
+
+/**
+ *  This function retrieves the progress of a background flush job started by
+ *  sx_api_fdb_uc_flush_job_set.
+ *  The state of a completed job is kept until the first of:
+ *   - a read by this function which returns *done_p TRUE,
+ *   - sx_api_fdb_uc_flush_job_set with command DESTROY,
+ *   - the closing of the handle which created the job.
+ *  Callers which only listen for the completion event (SX_TRAP_ID_FDB_FLUSH_JOB) should
+ *  release the job with command DESTROY once the event was received.
+ *
+ *  Supported devices: Spectrum.
+ *
+ * @param[in] handle            - SX-API handle
+ * @param[in] job_id            - flush job ID
+ * @param[out] flushed_cnt_p    - number of entries flushed so far
+ * @param[out] remaining_cnt_p  - number of matching entries not flushed yet (may be NULL)
+ * @param[out] done_p           - TRUE if the job completed
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully
+ * @return SX_STATUS_INVALID_HANDLE if a NULL handle is received
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL
+ * @return SX_STATUS_ENTRY_NOT_FOUND if the job does not exist
+ * @return SX_STATUS_ERROR for a general error
+ */
+sx_status_t sx_api_fdb_uc_flush_job_get(const sx_api_handle_t handle,
+                                        const uint32_t        job_id,
+                                        uint32_t             *flushed_cnt_p,
+                                        uint32_t             *remaining_cnt_p,
+                                        boolean_t            *done_p);
+
 /**
  *  This function deletes all FDB MC tables on a switch partition.
  *
@@ -1028,6 +1387,217 @@ sx_status_t sx_api_fdb_notify_params_get(const sx_api_handle_t   handle,
                                          const sx_swid_t         swid,
                                          sx_fdb_notify_params_t *notify_params_p);
 
+/**
+ *  This function sets FDB notification coalescing parameters.
+ *  Note: Only takes effect when controlled learn mode is set.
+ *
+ *  When coalescing is enabled, learn and age notifications of the swid are held in the
+ *  SDK for coalesce_params_p->window (in milliseconds) and merged per (fid, mac):
+ *   - several learn notifications of the same MAC on different ports (MAC move) are
+ *     delivered as a single learn notification on the last port,
+ *   - a learn of a MAC which has no FDB entry, followed by an age of the same MAC within
+ *     the window, cancel each other. When the MAC already has an entry (the learn reports
+ *     a move), both are kept, so that the age reaches the user and the entry is removed,
+ *   - an age followed by a learn of the same MAC within the window are both delivered, in
+ *     this order, so that the entry is removed and learned again on the new port,
+ *   - duplicate notifications are dropped.
+ *  The remaining notifications are delivered in records of up to
+ *  coalesce_params_p->max_batch_size entries through the host_ifc event channel,
+ *  and can be read with sx_lib_host_ifc_recv_list. A record is delivered when the window
+ *  ends or when it is full, whichever comes first.
+ *  When more than coalesce_params_p->max_pending notifications are held, new
+ *  notifications are dropped and counted (see sx_api_fdb_notify_counters_get).
+ *
+ *  coalesce_params_p (sx_fdb_notify_coalesce_params_t) holds:
+ *   - window         - uint32_t, coalescing window in milliseconds, 0 to 1000. 0 disables
+ *                      coalescing
+ *   - max_batch_size - uint32_t, maximum number of notifications per record, 1 to
+ *                      SX_FDB_NOTIFY_SIZE_MAX
+ *   - max_pending    - uint32_t, maximum number of held notifications, at least
+ *                      max_batch_size
+ *  Records have the format of uncoalesced FDB notifications (sx_fdb_notify_data_t, in
+ *  receive_info->event_info.fdb_notify) and use the same trap ID, SX_TRAP_ID_FDB_EVENT,
+ *  so receivers are not changed by enabling coalescing.
+ *
+ *  Supported devices: Spectrum.
+ *
+ * @param[in] handle             - SX-API handle
+ * @param[in] swid               - virtual switch partition ID
+ * @param[in] coalesce_params_p  - new coalescing params (window 0 disables coalescing)
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully
+ * @return SX_STATUS_INVALID_HANDLE if a NULL handle is received
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if a parameter exceeds its range
+ * @return SX_STATUS_ENTRY_NOT_FOUND if requested element is not found in the DB
+ * @return SX_STATUS_ERROR for a general error
+ */
+sx_status_t sx_api_fdb_notify_coalesce_set(const sx_api_handle_t                  handle,
+                                           const sx_swid_t                        swid,
+                                           const sx_fdb_notify_coalesce_params_t *coalesce_params_p);
+
+/**
+ *  This function gets FDB notification coalescing parameters.
+ *
+ *  Supported devices: Spectrum.
+ *
+ * @param[in] handle              - SX-API handle
+ * @param[in] swid                - virtual switch partition id
+ * @param[out] coalesce_params_p  - swid's coalescing params
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully
+ * @return SX_STATUS_INVALID_HANDLE if a NULL handle is received
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if a parameter exceeds its range
+ * @return SX_STATUS_ENTRY_NOT_FOUND if requested element is not found in the DB
+ * @return SX_STATUS_ERROR for a general error
+ */
+sx_status_t sx_api_fdb_notify_coalesce_get(const sx_api_handle_t            handle,
+                                           const sx_swid_t                  swid,
+                                           sx_fdb_notify_coalesce_params_t *coalesce_params_p);
+
+/**
+ *  This function gets the FDB notification counters of a swid: the number of
+ *  notifications received from the device, delivered, merged by coalescing and dropped.
+ *  counters_p (sx_fdb_notify_counters_t) holds these counters as uint64_t fields
+ *  received, delivered, merged and dropped, in this order; received equals
+ *  delivered + merged + dropped + the number of notifications currently held.
+ *  When using cmd=READ_CLEAR, the counters will be returned and cleared.
+ *
+ *  Supported devices: Spectrum.
+ *
+ * @param[in] handle            - SX-API handle
+ * @param[in] cmd               - READ/READ_CLEAR
+ * @param[in] swid              - virtual switch partition id
+ * @param[out] counters_p       - notification counters
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully
+ * @return SX_STATUS_INVALID_HANDLE if a NULL handle is received
+ * @return SX_STATUS_CMD_UNSUPPORTED if command is not supported
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if a parameter exceeds its range
+ * @return SX_STATUS_ERROR for a general error
+ */
+sx_status_t sx_api_fdb_notify_counters_get(const sx_api_handle_t     handle,
+                                           const sx_access_cmd_t     cmd,
+                                           const sx_swid_t           swid,
+                                           sx_fdb_notify_counters_t *counters_p);
+
+/**
+ *  This function sets the MAC move detection and dampening parameters of a swid.
+ *  Note: Only takes effect when controlled learn mode is set.
+ *
+ *  The SDK counts, per (fid, mac), the learn notifications which report the MAC on a
+ *  port other than the one it is learned on. When a MAC moves more than
+ *  move_params_p->threshold times within move_params_p->interval seconds, it is
+ *  dampened for move_params_p->hold_time seconds, according to move_params_p->action:
+ *   - PIN: the SDK rewrites the HW entry of the MAC as a static (non-aging) entry on its
+ *     current port. The device then no longer reports moves of the MAC, so the learn
+ *     path is relieved from the device onwards. When hold_time ends, the entry is
+ *     rewritten as a dynamic entry. While pinned, the entry is reported as static by
+ *     sx_api_fdb_uc_mac_addr_get, and sx_api_fdb_uc_mac_addr_set on the MAC ends
+ *     its dampening,
+ *   - DROP_LEARN: the HW entry is left as is, and the learn notifications of the MAC which
+ *     the device still reports are dropped by the SDK,
+ *   - RATE_LIMIT: at most one move of the MAC per move_params_p->interval is applied.
+ *  Dampening is applied before the notifications are coalesced (see
+ *  sx_api_fdb_notify_coalesce_set), so dampened moves do not reach the user.
+ *  A threshold of 0 disables move detection.
+ *
+ *  move_params_p (sx_fdb_mac_move_params_t) holds:
+ *   - threshold - uint32_t, number of moves within interval which dampens a MAC, 0 to 1000
+ *   - interval  - uint32_t, detection interval in seconds, 1 to 3600
+ *   - hold_time - uint32_t, dampening time in seconds, 1 to 86400
+ *   - action    - sx_fdb_mac_move_action_e: SX_FDB_MAC_MOVE_ACTION_PIN,
+ *                 SX_FDB_MAC_MOVE_ACTION_DROP_LEARN or SX_FDB_MAC_MOVE_ACTION_RATE_LIMIT
+ *
+ *  Supported devices: Spectrum.
+ *
+ * @param[in] handle          - SX-API handle
+ * @param[in] swid            - virtual switch partition ID
+ * @param[in] move_params_p   - new move detection params
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully
+ * @return SX_STATUS_INVALID_HANDLE if a NULL handle is received
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if a parameter exceeds its range
+ * @return SX_STATUS_ENTRY_NOT_FOUND if requested element is not found in the DB
+ * @return SX_STATUS_ERROR for a general error
+ */
+sx_status_t sx_api_fdb_mac_move_params_set(const sx_api_handle_t           handle,
+                                           const sx_swid_t                 swid,
+                                           const sx_fdb_mac_move_params_t *move_params_p);
+
+/**
+ *  This function gets the MAC move detection and dampening parameters of a swid.
+ *
+ *  Supported devices: Spectrum.
+ *
+ * @param[in] handle          - SX-API handle
+ * @param[in] swid            - virtual switch partition id
+ * @param[out] move_params_p  - swid's move detection params
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully
+ * @return SX_STATUS_INVALID_HANDLE if a NULL handle is received
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if a parameter exceeds its range
+ * @return SX_STATUS_ENTRY_NOT_FOUND if requested element is not found in the DB
+ * @return SX_STATUS_ERROR for a general error
+ */
+sx_status_t sx_api_fdb_mac_move_params_get(const sx_api_handle_t     handle,
+                                           const sx_swid_t           swid,
+                                           sx_fdb_mac_move_params_t *move_params_p);
+
+/**
+ *  This function gets the MAC move counters of a swid: the number of moves detected,
+ *  the number of moves suppressed by dampening, and the number of MACs which are
+ *  currently dampened.
+ *  When using cmd=READ_CLEAR, the move and suppression counters are returned and cleared.
+ *  counters_p (sx_fdb_mac_move_counters_t) holds the uint64_t fields moves_detected and
+ *  moves_suppressed, and the uint32_t field dampened_cnt, which READ_CLEAR does not clear.
+ *
+ *  Supported devices: Spectrum.
+ *
+ * @param[in] handle            - SX-API handle
+ * @param[in] cmd               - READ/READ_CLEAR
+ * @param[in] swid              - virtual switch partition id
+ * @param[out] counters_p       - MAC move counters
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully
+ * @return SX_STATUS_INVALID_HANDLE if a NULL handle is received
+ * @return SX_STATUS_CMD_UNSUPPORTED if command is not supported
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if a parameter exceeds its range
+ * @return SX_STATUS_ERROR for a general error
+ */
+sx_status_t sx_api_fdb_mac_move_counters_get(const sx_api_handle_t       handle,
+                                             const sx_access_cmd_t       cmd,
+                                             const sx_swid_t             swid,
+                                             sx_fdb_mac_move_counters_t *counters_p);
+
+/**
+ *  This function retrieves the MACs of a swid which are currently dampened, with the
+ *  port they are learned on.
+ *  If *data_cnt_p is 0, only the number of dampened MACs is returned.
+ *
+ *  Supported devices: Spectrum.
+ *
+ * @param[in] handle         - SX-API handle
+ * @param[in] swid           - virtual switch partition id
+ * @param[out] mac_list_p    - list of dampened MAC entries
+ * @param[in,out] data_cnt_p - size of mac_list_p, also retrieved number of entries
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully
+ * @return SX_STATUS_INVALID_HANDLE if a NULL handle is received
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if a parameter exceeds its range
+ * @return SX_STATUS_ERROR for a general error
+ */
+sx_status_t sx_api_fdb_mac_move_dampened_get(const sx_api_handle_t        handle,
+                                             const sx_swid_t              swid,
+                                             sx_fdb_uc_mac_addr_params_t *mac_list_p,
+                                             uint32_t                    *data_cnt_p);
+
 /**
  * This function is used to block ports from flooding of selected FID.
  *
@@ -1290,10 +1860,113 @@ sx_status_t sx_api_fdb_igmpv3_state_get(const sx_api_handle_t  handle,
                                         const sx_fid_t         fid,
                                         sx_fdb_igmpv3_state_t* fdb_igmpv3_snooping_state);
 
+/**
+ * This function ingests a list of IGMPv3 group records into the SDK source filter state.
+ * IGMP v3 state must be enabled on the FID (see sx_api_fdb_igmpv3_state_set).
+ *
+ * The SDK keeps, per FID, group and port, the filter mode and the source lists of RFC 3376:
+ * INCLUDE(A), or EXCLUDE(X,Y) where X are the requested (forwarded) sources and Y the
+ * excluded ones. Records are applied in list order.
+ *
+ * Each record (sx_fdb_igmpv3_record_t) holds:
+ *  - log_port    - port the report was received on
+ *  - group_addr  - group address
+ *  - record_type - sx_fdb_igmpv3_record_type_e, one of:
+ *    - SX_FDB_IGMPV3_RECORD_IS_INCLUDE, SX_FDB_IGMPV3_RECORD_IS_EXCLUDE,
+ *      SX_FDB_IGMPV3_RECORD_TO_INCLUDE, SX_FDB_IGMPV3_RECORD_TO_EXCLUDE,
+ *      SX_FDB_IGMPV3_RECORD_ALLOW, SX_FDB_IGMPV3_RECORD_BLOCK:
+ *      the record types of host reports, applied with the router-side state transitions of
+ *      RFC 3376 section 6.4, without the timer actions,
+ *    - SX_FDB_IGMPV3_RECORD_SOURCE_TIMEOUT: the caller's source timers of the sources in
+ *      source_list expired. In INCLUDE(A) they are removed from A; in EXCLUDE(X,Y) they are
+ *      moved from X to Y,
+ *    - SX_FDB_IGMPV3_RECORD_GROUP_TIMEOUT: the caller's group timer expired. EXCLUDE(X,Y)
+ *      changes to INCLUDE(X). No effect in INCLUDE mode. source_list is ignored.
+ *    An INCLUDE state with an empty source list is deleted.
+ *  - source_cnt  - number of sources in source_list, up to SX_FDB_IGMPV3_SOURCES_MAX (64)
+ *  - source_list - array of SX_FDB_IGMPV3_SOURCES_MAX source addresses
+ * Timers are kept by the caller, which reports their expiry with the two TIMEOUT record
+ * types; the SDK does not age the state by itself.
+ * A record whose resulting source list exceeds SX_FDB_IGMPV3_SOURCES_MAX fails with
+ * SX_STATUS_NO_RESOURCES and leaves the state of its port unchanged.
+ *
+ * From this state the SDK derives the port list of every (S,G) and (*,G) MC IP entry of
+ * the FID, and programs the MC IP entries (see sx_api_fdb_mc_ip_addr_group_set) whose
+ * port list changed once all the records were applied. Port lists are shared as by
+ * sx_api_fdb_mc_ip_addr_group_port_set. Records which do not change the port list of any
+ * entry cause no HW write.
+ * MC IP entries of the FID are maintained by this function while IGMP v3 state is enabled
+ * on the FID: sx_api_fdb_mc_ip_addr_group_set, sx_api_fdb_mc_ip_addr_group_bulk_set and
+ * sx_api_fdb_mc_ip_addr_group_port_set return SX_STATUS_RESOURCE_IN_USE for them.
+ * The result of every record is returned in status_list_p[i].
+ *
+ * Supported devices: Spectrum.
+ *
+ * @param[in] handle            - SX-API handle
+ * @param[in] fid               - FID
+ * @param[in] record_list_p     - list of group records {port, group, record type, source list}
+ * @param[out] status_list_p    - per-record operation status
+ * @param[in,out] record_cnt_p  - number of records in the lists, also number of records
+ *                                applied successfully
+ *
+ * @return SX_STATUS_SUCCESS if all records were applied successfully
+ * @return SX_STATUS_PARTIALLY_COMPLETE if some of the records failed
+ * @return SX_STATUS_INVALID_HANDLE if a NULL handle is received
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if a parameter exceeds its range
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL
+ * @return SX_STATUS_PARAM_ERROR if IGMP v3 state is disabled on the FID
+ * @return SX_STATUS_NO_RESOURCES if no MC IP entry is available to create
+ * @return SX_STATUS_ERROR for a general error
+ */
+sx_status_t sx_api_fdb_igmpv3_record_set(const sx_api_handle_t         handle,
+                                         const sx_fid_t                fid,
+                                         const sx_fdb_igmpv3_record_t *record_list_p,
+                                         sx_status_t                  *status_list_p,
+                                         uint32_t                     *record_cnt_p);
+
+/**
+ * This function gets the IGMPv3 source filter state of a group on a FID.
+ * port_state_list_p[i] returns the state of one port which has state for group_addr_p
+ * (sx_fdb_igmpv3_port_state_t):
+ *  - log_port     - port
+ *  - filter_mode  - SX_FDB_IGMPV3_FILTER_MODE_INCLUDE or SX_FDB_IGMPV3_FILTER_MODE_EXCLUDE
+ *  - source_cnt   - number of sources in source_list: A in INCLUDE mode, X in EXCLUDE mode
+ *  - source_list  - array of SX_FDB_IGMPV3_SOURCES_MAX source addresses
+ *  - exclude_cnt  - number of sources in exclude_list (Y). 0 in INCLUDE mode
+ *  - exclude_list - array of SX_FDB_IGMPV3_SOURCES_MAX source addresses
+ * If *port_state_cnt_p is 0, only the number of ports is returned.
+ *
+ * Supported devices: Spectrum.
+ *
+ * @param[in] handle                - SX-API handle
+ * @param[in] fid                   - FID
+ * @param[in] group_addr_p          - group address
+ * @param[out] port_state_list_p    - list of per-port filter states
+ * @param[in,out] port_state_cnt_p  - size of port_state_list_p, also number of ports returned
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully
+ * @return SX_STATUS_INVALID_HANDLE if a NULL handle is received
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if a parameter exceeds its range
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL
+ * @return SX_STATUS_ENTRY_NOT_FOUND if the group has no state on the FID
+ * @return SX_STATUS_ERROR for a general error
+ */
+sx_status_t sx_api_fdb_igmpv3_group_state_get(const sx_api_handle_t       handle,
+                                              const sx_fid_t              fid,
+                                              const sx_ip_addr_t         *group_addr_p,
+                                              sx_fdb_igmpv3_port_state_t *port_state_list_p,
+                                              uint32_t                   *port_state_cnt_p);
+
 /**
  * This function set MC IP entries.
  * using multicast container as destination.
  *
+ * The container ID in fdb_mc_ip_action must be a container created by
+ * sx_api_mc_container_set. Multicast containers owned by the SDK (see
+ * sx_api_fdb_mc_ip_addr_group_port_set) cannot be used, and return SX_STATUS_PARAM_ERROR.
+ * MC IP entries of a FID with IGMP v3 state enabled are maintained by
+ * sx_api_fdb_igmpv3_record_set, and cannot be set by this function.
+ *
  * Supported devices: Spectrum.
  *
  * @param[in] handle           - SX-API handle
@@ -1310,6 +1983,7 @@ sx_status_t sx_api_fdb_igmpv3_state_get(const sx_api_handle_t  handle,
  * @return SX_STATUS_PARAM_ERROR if an input parameter is invalid
  * @return SX_STATUS_ENTRY_NOT_FOUND if requested element is not found in the DB
  * @return SX_STATUS_ENTRY_ALREADY_EXISTS if group_addr is already added
+ * @return SX_STATUS_RESOURCE_IN_USE if IGMP v3 state is enabled on the FID
  * @return SX_STATUS_ERROR for a general error
  */
 sx_status_t sx_api_fdb_mc_ip_addr_group_set(const sx_api_handle_t        handle,
@@ -1317,6 +1991,72 @@ sx_status_t sx_api_fdb_mc_ip_addr_group_set(const sx_api_handle_t        handle,
                                             const sx_fdb_mc_ip_key_t   * mc_fdb_mc_ip_key,
                                             const sx_fdb_mc_ip_action_t* fdb_mc_ip_action);
 
+/**
+ * This function sets a list of MC IP entries in a single call.
+ * Each entry i is handled exactly as by sx_api_fdb_mc_ip_addr_group_set with the same
+ * cmd, with mc_ip_key_list_p[i] and mc_ip_action_list_p[i].
+ * The result of every entry is returned in status_list_p[i].
+ * On return, *group_cnt_p holds the number of entries which were programmed successfully.
+ *
+ * Supported devices: Spectrum.
+ *
+ * @param[in] handle              - SX-API handle
+ * @param[in] cmd                 - add/delete
+ * @param[in] mc_ip_key_list_p    - list of FID/SIP/DIP of the MC groups
+ * @param[in] mc_ip_action_list_p - list of Action/Container ID/ Trap. Ignored for delete (may be NULL)
+ * @param[out] status_list_p      - per-entry operation status
+ * @param[in,out] group_cnt_p     - number of entries in the lists, also number of entries
+ *                                  programmed successfully
+ *
+ * @return SX_STATUS_SUCCESS if all entries were programmed successfully
+ * @return SX_STATUS_PARTIALLY_COMPLETE if some of the entries failed
+ * @return SX_STATUS_INVALID_HANDLE if a NULL handle is received
+ * @return SX_STATUS_CMD_UNSUPPORTED if command is not supported
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if a parameter exceeds its range
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL
+ * @return SX_STATUS_ERROR for a general error
+ */
+sx_status_t sx_api_fdb_mc_ip_addr_group_bulk_set(const sx_api_handle_t        handle,
+                                                 const sx_access_cmd_t        cmd,
+                                                 const sx_fdb_mc_ip_key_t    *mc_ip_key_list_p,
+                                                 const sx_fdb_mc_ip_action_t *mc_ip_action_list_p,
+                                                 sx_status_t                 *status_list_p,
+                                                 uint32_t                    *group_cnt_p);
+
+/**
+ * This function adds/deletes a port to/from the port list of a set of MC IP entries.
+ * Port lists are kept in SDK-owned multicast containers and updated as by
+ * sx_api_fdb_mc_mac_addr_group_port_set: caller-owned containers are never modified nor
+ * destroyed, and the HW cost of the update is one container write per distinct port list
+ * among the given groups, plus one MC IP entry write per entry which moved to another
+ * container. Setting the entry again with sx_api_fdb_mc_ip_addr_group_set moves it back
+ * to a caller-owned container.
+ * Entries given here must use a multicast container as destination.
+ *
+ * Supported devices: Spectrum.
+ *
+ * @param[in] handle           - SX-API handle
+ * @param[in] cmd              - add/delete
+ * @param[in] mc_ip_key_list_p - list of FID/SIP/DIP of the MC groups
+ * @param[in] group_cnt        - number of entries in mc_ip_key_list_p
+ * @param[in] log_port         - logical port to add/delete
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully
+ * @return SX_STATUS_INVALID_HANDLE if a NULL handle is received
+ * @return SX_STATUS_CMD_UNSUPPORTED if command is not supported
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if a parameter exceeds its range
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL
+ * @return SX_STATUS_ENTRY_NOT_FOUND if a group does not exist
+ * @return SX_STATUS_NO_RESOURCES if no multicast container is available to create
+ * @return SX_STATUS_RESOURCE_IN_USE if IGMP v3 state is enabled on the FID of a group
+ * @return SX_STATUS_ERROR for a general error
+ */
+sx_status_t sx_api_fdb_mc_ip_addr_group_port_set(const sx_api_handle_t     handle,
+                                                 const sx_access_cmd_t     cmd,
+                                                 const sx_fdb_mc_ip_key_t *mc_ip_key_list_p,
+                                                 const uint32_t            group_cnt,
+                                                 const sx_port_log_id_t    log_port);
+
 /**
  * This function get MC IP entries.
  * using multicast container as destination.
@@ -1527,4 +2267,63 @@ sx_status_t sx_api_fdb_mc_ip_addr_group_activity_notify(const sx_api_handle_t
                                                         const sx_access_cmd_t        cmd,
                                                         const sx_fdb_mc_ip_filter_t *filter_p);
 
+/**
+ * This function enables/disables the persistent mc fdb entry activity tracker.
+ * While the tracker is enabled, the SDK keeps an idle timer per mc fdb entry matching
+ * filter_p. An entry becomes idle when no traffic hit it for stream_params_p->idle_time
+ * seconds, and becomes active again on its next hit. Only these state changes are
+ * reported, in batches of up to stream_params_p->max_batch_size entries, as events with
+ * trap ID SX_TRAP_ID_FDB_MC_ACTIVITY_CHANGE, which can be read with
+ * sx_lib_host_ifc_recv_list on a file descriptor registered to this trap ID.
+ * stream_params_p->scan_budget bounds the number of entries scanned per sweep slice.
+ * While the tracker is enabled, sx_api_fdb_mc_ip_addr_group_activity_notify returns
+ * SX_STATUS_RESOURCE_IN_USE.
+ *
+ * stream_params_p (sx_fdb_mc_ip_activity_stream_params_t) holds:
+ *  - idle_time      - uint32_t, idle time in seconds, 1 to 86400
+ *  - scan_budget    - uint32_t, maximum number of entries scanned per sweep slice, 1 to 65536
+ *  - max_batch_size - uint32_t, maximum number of changes per event, 1 to
+ *                     SX_FDB_MC_ACTIVITY_BATCH_MAX (64)
+ * Each event (sx_fdb_mc_ip_activity_event_t, in receive_info->event_info.fdb_mc_activity)
+ * holds entry_cnt and a list of entries {mc_ip_key, active}, where active is TRUE when the
+ * entry became active and FALSE when it became idle.
+ *
+ *  Supported devices: Spectrum, Spectrum2
+ *
+ * @param[in] handle          - SX-API handle
+ * @param[in] cmd             - ENABLE\DISABLE
+ * @param[in] filter_p        - activity notifier filter. Applicable only for command ENABLE
+ * @param[in] stream_params_p - idle time, scan budget and batch size. Applicable only for command ENABLE
+ *
+ * @return SX_STATUS_SUCCESS             if operation completes successfully.
+ * @return SX_STATUS_CMD_UNSUPPORTED     if access command isn't supported.
+ * @return SX_STATUS_PARAM_NULL          if parameter is NULL.
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if a parameter exceeds its range.
+ * @return SX_STATUS_RESOURCE_IN_USE     if a notification procedure is already running.
+ * @return SX_STATUS_ERROR               general error.
+ */
+sx_status_t sx_api_fdb_mc_ip_addr_group_activity_stream_set(const sx_api_handle_t                        handle,
+                                                            const sx_access_cmd_t                        cmd,
+                                                            const sx_fdb_mc_ip_filter_t                 *filter_p,
+                                                            const sx_fdb_mc_ip_activity_stream_params_t *stream_params_p);
+
+/**
+ * This function retrieves the state and parameters of the mc fdb entry activity tracker.
+ *
+ *  Supported devices: Spectrum, Spectrum2
+ *
+ * @param[in] handle           - SX-API handle
+ * @param[out] enabled_p       - TRUE if the tracker is enabled
+ * @param[out] filter_p        - activity notifier filter
+ * @param[out] stream_params_p - idle time, scan budget and batch size
+ *
+ * @return SX_STATUS_SUCCESS             if operation completes successfully.
+ * @return SX_STATUS_PARAM_NULL          if parameter is NULL.
+ * @return SX_STATUS_ERROR               general error.
+ */
+sx_status_t sx_api_fdb_mc_ip_addr_group_activity_stream_get(const sx_api_handle_t                  handle,
+                                                            boolean_t                             *enabled_p,
+                                                            sx_fdb_mc_ip_filter_t                 *filter_p,
+                                                            sx_fdb_mc_ip_activity_stream_params_t *stream_params_p);
+
 #endif /* __SX_API_FDB_H__ */
@@ -96,6 +96,95 @@ sx_status_t sx_api_open(sx_log_cb_t      logging_cb,
  */
 sx_status_t sx_api_close(sx_api_handle_t *handle);
 
+/**
+ *  This function enables/disables asynchronous command submission on an SX-API handle.
+ *  While asynchronous mode is enabled, calls to the following APIs on this handle
+ *  are queued to the SDK and return as soon as the request was sent, without
+ *  waiting for its completion:
+ *   - sx_api_router_neigh_set
+ *   - sx_api_router_uc_route_set
+ *   - sx_api_fdb_uc_mac_addr_set
+ *  Each queued request is assigned a completion token, which may be read with
+ *  sx_api_async_token_get right after the call. Tokens are increasing per handle.
+ *  The SDK executes queued requests in submission order. Output parameters of a
+ *  queued request are not updated, hence SOFT_ADD of sx_api_router_uc_route_set is
+ *  not supported in this mode. For the same reason, the failed entries of
+ *  sx_api_fdb_uc_mac_addr_set are not reported: mac_list_p and data_cnt_p are left
+ *  unchanged, and only the status of the request is returned in its completion.
+ *  Callers which need to know which entries failed should queue one entry per request,
+ *  or use the synchronous mode. All other APIs called on this handle remain
+ *  synchronous, and wait for the completion of all preceding queued requests.
+ *  A request is in flight from its submission until its completion is retrieved by
+ *  sx_api_async_completion_get. When max_in_flight requests are in flight, a new
+ *  request is not queued and the call returns SX_STATUS_NO_RESOURCES immediately,
+ *  without blocking. The caller should retrieve completions and submit it again.
+ *
+ *  When cmd is ENABLE, fd_p returns a file descriptor which becomes readable
+ *  (select/poll/epoll) while completions are pending on the handle.
+ *  When cmd is DISABLE, the call waits for all in-flight requests to complete and
+ *  discards completions which were not retrieved by sx_api_async_completion_get.
+ *
+ *  Supported devices: SwitchX, SwitchX2, Spectrum.
+ *
+ * @param[in] handle - SX-API handle.
+ * @param[in] cmd - ENABLE/DISABLE.
+ * @param[in] max_in_flight - maximum number of queued requests which did not complete yet.
+ *                            Applicable only for command ENABLE.
+ * @param[out] fd_p - completion file descriptor. Applicable only for command ENABLE.
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully.
+ * @return SX_STATUS_CMD_UNSUPPORTED if access command isn't supported.
+ * @return SX_STATUS_PARAM_NULL if parameter is NULL.
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if max_in_flight is 0 or exceeds range.
+ * @return SX_STATUS_PARAM_ERROR if a transaction is open on the handle (ENABLE).
+ * @return SX_STATUS_INVALID_HANDLE if handle is invalid.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_async_mode_set(const sx_api_handle_t handle,
+                                  const sx_access_cmd_t cmd,
+                                  const uint32_t        max_in_flight,
+                                  sx_fd_t              *fd_p);
+
+/**
+ *  This function returns the completion token of the last request queued on
+ *  the handle in asynchronous mode.
+ *  Supported devices: SwitchX, SwitchX2, Spectrum.
+ *
+ * @param[in] handle - SX-API handle.
+ * @param[out] token_p - completion token.
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully.
+ * @return SX_STATUS_PARAM_NULL if parameter is NULL.
+ * @return SX_STATUS_ENTRY_NOT_FOUND if no request was queued since asynchronous mode was enabled.
+ * @return SX_STATUS_INVALID_HANDLE if handle is invalid.
+ * @return SX_STATUS_ERROR if asynchronous mode is not enabled on the handle.
+ */
+sx_status_t sx_api_async_token_get(const sx_api_handle_t handle,
+                                   uint64_t             *token_p);
+
+/**
+ *  This function retrieves the completions of requests queued in asynchronous mode.
+ *  Completions are returned in submission order, and each completion is returned once.
+ *  The function does not block; if no completion is pending *completion_cnt_p is set to 0.
+ *  The request with token token_list_p[i] completed with status status_list_p[i], which
+ *  is the status the same call would have returned in synchronous mode.
+ *  Supported devices: SwitchX, SwitchX2, Spectrum.
+ *
+ * @param[in] handle - SX-API handle.
+ * @param[out] token_list_p - list of completion tokens.
+ * @param[out] status_list_p - list of completion statuses.
+ * @param[in,out] completion_cnt_p - [in] size of the lists / [out] number of completions returned.
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully.
+ * @return SX_STATUS_PARAM_NULL if parameter is NULL.
+ * @return SX_STATUS_INVALID_HANDLE if handle is invalid.
+ * @return SX_STATUS_ERROR if asynchronous mode is not enabled on the handle.
+ */
+sx_status_t sx_api_async_completion_get(const sx_api_handle_t handle,
+                                        uint64_t             *token_list_p,
+                                        sx_status_t          *status_list_p,
+                                        uint32_t             *completion_cnt_p);
+
 /**
  * This function initializes SwitchX SDK.
  * Supported devices: SwitchX, SwitchX2, Spectrum.
@@ -131,19 +220,89 @@ sx_status_t sx_api_sx_sdk_version_get(const sx_api_handle_t     handle,
 
 /**
  *  This function is used to enter/exit transaction burst mode.
+ *
+ *  Command ENABLE opens a transaction on the handle. While the transaction is open,
+ *  calls on this handle to the following APIs are validated and recorded by the SDK,
+ *  but their hardware writes are deferred:
+ *   - sx_api_router_uc_route_set, sx_api_router_neigh_set, sx_api_router_ecmp_set
+ *   - sx_api_fdb_uc_mac_addr_set, sx_api_fdb_mc_mac_addr_group_set
+ *   - sx_api_acl_rules_set, sx_api_acl_flex_rules_set
+ *  A recorded call returns SX_STATUS_SUCCESS once it was validated, or a validation
+ *  error, in which case it is not recorded. IDs allocated by a recorded call (e.g.
+ *  ECMP container ID) are returned immediately.
+ *  A recorded call is validated against the committed state with the operations
+ *  recorded before it in the transaction applied, so later recorded calls may refer
+ *  to objects created or deleted earlier in the same transaction (e.g. a route on an
+ *  ECMP container created by a recorded sx_api_router_ecmp_set CREATE).
+ *  Output parameters which depend on the hardware are not available while the writes
+ *  are deferred:
+ *   - SOFT_ADD of sx_api_router_uc_route_set is rejected with SX_STATUS_CMD_UNSUPPORTED,
+ *   - CREATE and SET of sx_api_router_ecmp_set return the requested next hop list and
+ *     count unchanged. The next hops as written on HW may be read with
+ *     sx_api_router_operational_ecmp_get after the commit,
+ *   - sx_api_fdb_uc_mac_addr_set leaves mac_list_p and data_cnt_p unchanged. Entries
+ *     which fail at commit are reported by sx_api_transaction_result_get as the status
+ *     of the call.
+ *  Get APIs called while a transaction is open, on this handle or on others, return the
+ *  committed state without the recorded operations, which are applied only by the
+ *  commit. E.g. sx_api_router_ecmp_get of a container created in the open transaction
+ *  returns SX_STATUS_ENTRY_NOT_FOUND.
+ *  When the handle is closed by sx_api_close with a transaction open, the transaction is
+ *  discarded: none of its recorded operations is applied, and IDs it allocated are freed.
+ *  A transaction cannot be opened on a handle in asynchronous mode (see
+ *  sx_api_async_mode_set), and asynchronous mode cannot be enabled while a transaction
+ *  is open; both return SX_STATUS_PARAM_ERROR.
+ *  Command DISABLE commits the transaction: recorded operations are applied to the
+ *  SDK databases in call order, writes to the same hardware register are coalesced,
+ *  and the resulting register writes are flushed to the device at once.
+ *  The result of every recorded operation may then be read by sx_api_transaction_result_get.
+ *  Calls to other APIs while a transaction is open are executed immediately.
+ *
  *  Supported devices: Spectrum
  *
  * @param[in] handle - SX-API handle
  * @param[in] cmd - ENABLE /DISABLE
  *
  * @return SX_STATUS_SUCCESS if operation completes successfully
- * @return SX_STATUS_PARAM_ERROR if any input parameter is invalid
+ * @return SX_STATUS_PARAM_ERROR if any input parameter is invalid, or if asynchronous mode
+ *         is enabled on the handle (ENABLE)
  * @return SX_STATUS_ERROR if unexpected behaviour occurs
  * @return SX_STATUS_INVALID_HANDLE if handle is invalid
+ * @return SX_STATUS_PARTIALLY_COMPLETE if DISABLE committed the transaction, but one or
+ *         more recorded operations failed
  */
 sx_status_t sx_api_transaction_mode_set(const sx_api_handle_t handle,
                                         const sx_access_cmd_t cmd);
 
+/**
+ *  This function retrieves the results of the last transaction committed on the handle
+ *  by sx_api_transaction_mode_set(DISABLE).
+ *  status_list_p[i] is the status of the i-th operation recorded in the transaction.
+ *  If *op_cnt_p is 0, only the number of recorded operations is returned.
+ *  hw_write_cnt_p returns the number of hardware register writes flushed by the commit,
+ *  and hw_write_coalesced_cnt_p the number of writes which were saved by coalescing.
+ *  The results are kept until the next transaction is opened on the handle.
+ *
+ *  Supported devices: Spectrum
+ *
+ * @param[in] handle - SX-API handle
+ * @param[out] status_list_p - per-operation status (may be NULL if *op_cnt_p is 0)
+ * @param[in,out] op_cnt_p - [in] size of status_list_p / [out] number of recorded operations
+ * @param[out] hw_write_cnt_p - number of hardware register writes performed (may be NULL)
+ * @param[out] hw_write_coalesced_cnt_p - number of coalesced hardware register writes (may be NULL)
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully
+ * @return SX_STATUS_PARAM_NULL if op_cnt_p is NULL
+ * @return SX_STATUS_ENTRY_NOT_FOUND if no transaction was committed on the handle
+ * @return SX_STATUS_INVALID_HANDLE if handle is invalid
+ * @return SX_STATUS_ERROR if a transaction is currently open on the handle
+ */
+sx_status_t sx_api_transaction_result_get(const sx_api_handle_t handle,
+                                          sx_status_t          *status_list_p,
+                                          uint32_t             *op_cnt_p,
+                                          uint32_t             *hw_write_cnt_p,
+                                          uint32_t             *hw_write_coalesced_cnt_p);
+
 /**
  * This API is used to get the reference count of an SDK object.
  * On SwitchX and SwitchX2, for RIF and VRID objects, the reference count
@@ -74,6 +74,8 @@ sx_status_t sx_api_mc_container_log_verbosity_level_get(const sx_api_handle_t
  * Command DELETE_ALL deletes all existing containers.
  * Notes: A container in use (e.g. by a multicast route or ACL) cannot be destroyed
  *        A container may contain at most RM_API_ROUTER_RIFS_MAX next hops
+ *        Containers owned by the SDK (see sx_api_fdb_mc_mac_addr_group_port_set)
+ *        cannot be given in container_id_p, and are not deleted by DELETE_ALL
  *
  * Supported devices: Spectrum.
  *
@@ -85,7 +87,8 @@ sx_status_t sx_api_mc_container_log_verbosity_level_get(const sx_api_handle_t
  * @param[in] container_attr_p - Specifies the container attributes
  *
  * @return SX_STATUS_SUCCESS if operation completes successfully.
- * @return SX_STATUS_PARAM_ERROR if any input parameter is invalid.
+ * @return SX_STATUS_PARAM_ERROR if any input parameter is invalid, or if container_id_p
+ *         specifies a container owned by the SDK.
  * @return SX_STATUS_ENTRY_NOT_FOUND if specified container ID does not exist.
  * @return SX_STATUS_NO_RESOURCES if there are no resources for the operation.
  * @return SX_STATUS_RESOURCE_IN_USE if group is in use and cannot be destroyed.
@@ -164,6 +164,8 @@ sx_status_t sx_api_rm_entries_duplication_get(const sx_api_handle_t
 
 /**
  * This API gets the utilization of a logical resource in the SDK.
+ * When ECMP next hop set sharing is enabled (see sx_api_router_ecmp_sharing_set),
+ * an ECMP container shared by several routes is counted once.
  *
  * Supported devices: Spectrum, Spectrum2.
  *
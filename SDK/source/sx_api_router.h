@@ -328,6 +328,44 @@ sx_status_t sx_api_router_interface_set(const sx_api_handle_t              handl
                                         const sx_interface_attributes_t   *ifc_attr_p,
                                         sx_router_interface_t             *rif_p);
 
+/**
+ *  This function adds/deletes a list of router interfaces in a single call.
+ *  Each entry i is handled exactly as by sx_api_router_interface_set with the same cmd,
+ *  with vrid_list_p[i], ifc_list_p[i], ifc_attr_list_p[i] and rif_list_p[i].
+ *  On ADD, the new Router Interface IDs are returned in rif_list_p. On DELETE, the
+ *  Router Interface IDs are given in rif_list_p, and the other lists may be NULL.
+ *  Entries are processed in list order. A failure on one entry does not stop the
+ *  processing of the following entries; the result of every entry is returned in
+ *  status_list_p[i].
+ *  On return, *rif_cnt_p holds the number of entries which were programmed successfully.
+ *  Supported devices: Spectrum, Spectrum2 .
+ *
+ * @param[in] handle - SX-API handle.
+ * @param[in] cmd - ADD/DELETE.
+ * @param[in] vrid_list_p - list of Virtual Router IDs.
+ * @param[in] ifc_list_p - list of Interface types and parameters.
+ * @param[in] ifc_attr_list_p - list of Interface attributes.
+ * @param[in,out] rif_list_p - list of Router Interface IDs.
+ * @param[out] status_list_p - per-entry operation status.
+ * @param[in,out] rif_cnt_p - [in] number of entries in the lists /
+ *                            [out] number of entries programmed successfully.
+ *
+ * @return SX_STATUS_SUCCESS if all entries were programmed successfully.
+ * @return SX_STATUS_PARTIALLY_COMPLETE if some of the entries failed.
+ * @return SX_STATUS_CMD_UNSUPPORTED if access command isn't supported.
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if *rif_cnt_p is 0 or exceeds range.
+ * @return SX_STATUS_PARAM_NULL if parameter is NULL.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_interface_bulk_set(const sx_api_handle_t              handle,
+                                             const sx_access_cmd_t              cmd,
+                                             const sx_router_id_t              *vrid_list_p,
+                                             const sx_router_interface_param_t *ifc_list_p,
+                                             const sx_interface_attributes_t   *ifc_attr_list_p,
+                                             sx_router_interface_t             *rif_list_p,
+                                             sx_status_t                       *status_list_p,
+                                             uint32_t                          *rif_cnt_p);
+
 /**
  *  This function gets a router interface information.
  *  Supported devices: SwitchX, SwitchX2, Spectrum.
@@ -449,6 +487,31 @@ sx_status_t sx_api_router_interface_state_set(const sx_api_handle_t
                                               const sx_router_interface_t        rif,
                                               const sx_router_interface_state_t *rif_state_p);
 
+/**
+ *  This function sets the admin state of a list of router interfaces in a single call.
+ *  rif_state_list_p[i] is applied to rif_list_p[i] exactly as by
+ *  sx_api_router_interface_state_set. The result of every entry is returned in
+ *  status_list_p[i].
+ *  Supported devices: Spectrum, Spectrum2 .
+ *
+ * @param[in] handle - SX-API handle.
+ * @param[in] rif_list_p - list of Router Interface IDs.
+ * @param[in] rif_state_list_p - list of admin states.
+ * @param[out] status_list_p - per-entry operation status.
+ * @param[in] rif_cnt - number of entries in the lists.
+ *
+ * @return SX_STATUS_SUCCESS if all entries were set successfully.
+ * @return SX_STATUS_PARTIALLY_COMPLETE if some of the entries failed.
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if rif_cnt is 0 or exceeds range.
+ * @return SX_STATUS_PARAM_NULL if parameter is NULL.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_interface_state_bulk_set(const sx_api_handle_t              handle,
+                                                   const sx_router_interface_t       *rif_list_p,
+                                                   const sx_router_interface_state_t *rif_state_list_p,
+                                                   sx_status_t                       *status_list_p,
+                                                   const uint32_t                     rif_cnt);
+
 /**
  *  This function gets admin state of a router interface.
  *  Supported devices: SwitchX, SwitchX2, Spectrum.
@@ -558,6 +621,85 @@ sx_status_t sx_api_router_neigh_set(const sx_api_handle_t       handle,
                                     const sx_ip_addr_t         *ip_addr_p,
                                     const sx_neigh_data_t      *neigh_data_p);
 
+/**
+ *  This function adds/deletes a list of neighbors in a single call.
+ *  Each entry i is the tuple (rif_list_p[i], ip_addr_list_p[i], neigh_data_list_p[i])
+ *  and is handled exactly as by sx_api_router_neigh_set with the same cmd.
+ *  Entries are processed in list order. A failure on one entry does not stop the
+ *  processing of the following entries; the result of every entry is returned in
+ *  status_list_p[i].
+ *  On return, *neigh_cnt_p holds the number of entries which were programmed successfully.
+ *  Command DELETE_ALL is not supported by this function, use sx_api_router_neigh_set.
+ *
+ *  Supported devices: Spectrum.
+ *
+ * @param[in] handle - SX-API handle.
+ * @param[in] cmd - ADD/DELETE.
+ * @param[in] rif_list_p - list of Router Interface Ids.
+ * @param[in] ip_addr_list_p - list of IP addresses.
+ * @param[in] neigh_data_list_p - list of neighbors information. Ignored for DELETE (may be NULL).
+ * @param[out] status_list_p - per-entry operation status.
+ * @param[in,out] neigh_cnt_p - [in] number of entries in the lists /
+ *                              [out] number of entries programmed successfully.
+ *
+ * @return SX_STATUS_SUCCESS if all entries were programmed successfully.
+ * @return SX_STATUS_PARTIALLY_COMPLETE if some of the entries failed.
+ * @return SX_STATUS_CMD_UNSUPPORTED if access command isn't supported.
+ * @return SX_STATUS_PARAM_NULL if any list parameter is NULL.
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if *neigh_cnt_p is 0 or exceeds range.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_neigh_bulk_set(const sx_api_handle_t        handle,
+                                         const sx_access_cmd_t        cmd,
+                                         const sx_router_interface_t *rif_list_p,
+                                         const sx_ip_addr_t          *ip_addr_list_p,
+                                         const sx_neigh_data_t       *neigh_data_list_p,
+                                         sx_status_t                 *status_list_p,
+                                         uint32_t                    *neigh_cnt_p);
+
+/**
+ *  This function synchronizes the neighbors of a router interface with a desired
+ *  neighbor set.
+ *  The SDK compares the given set with the neighbors of rif whose IP version is
+ *  ip_version, and applies only the difference:
+ *   - neighbors in the set which do not exist are added,
+ *   - existing neighbors whose neighbor data differs from the set are modified,
+ *   - existing neighbors which are not in the set are deleted.
+ *  Neighbors whose data is unchanged cause no hardware write.
+ *  An empty set (neigh_cnt = 0) deletes all neighbors of rif with the given IP version.
+ *  All addresses in ip_addr_list_p must be of IP version ip_version, and must be unique.
+ *  If the operation fails on an entry, neighbors already synchronized are left in place,
+ *  and the function may be called again with the same set.
+ *
+ *  Supported devices: Spectrum.
+ *
+ * @param[in] handle - SX-API handle.
+ * @param[in] rif - Router Interface Id.
+ * @param[in] ip_version - IP version of the neighbors to synchronize.
+ * @param[in] ip_addr_list_p - desired list of neighbor IP addresses (may be NULL if neigh_cnt is 0).
+ * @param[in] neigh_data_list_p - desired list of neighbors information (may be NULL if neigh_cnt is 0).
+ * @param[in] neigh_cnt - number of entries in the lists.
+ * @param[out] added_cnt_p - number of neighbors added (may be NULL).
+ * @param[out] modified_cnt_p - number of neighbors modified (may be NULL).
+ * @param[out] deleted_cnt_p - number of neighbors deleted (may be NULL).
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully.
+ * @return SX_STATUS_PARAM_NULL if a list parameter is NULL while neigh_cnt is not 0.
+ * @return SX_STATUS_PARAM_ERROR if any input parameter is invalid, or the set holds duplicates.
+ * @return SX_STATUS_ENTRY_NOT_FOUND if rif does not exist.
+ * @return SX_STATUS_NO_RESOURCES if no neighbor entry is available to create.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_neigh_sync_set(const sx_api_handle_t       handle,
+                                         const sx_router_interface_t rif,
+                                         const sx_ip_version_t       ip_version,
+                                         const sx_ip_addr_t         *ip_addr_list_p,
+                                         const sx_neigh_data_t      *neigh_data_list_p,
+                                         const uint32_t              neigh_cnt,
+                                         uint32_t                   *added_cnt_p,
+                                         uint32_t                   *modified_cnt_p,
+                                         uint32_t                   *deleted_cnt_p);
+
 /**
  *  This function gets the neighbor's information.
  *
@@ -664,6 +806,8 @@ sx_status_t sx_api_router_neigh_activity_get(const sx_api_handle_t       handle,
  *  network_addr->version. If uc_route_data_p is NULL, then routes of type NEXT_HOP are
  *  deleted. If network_addr is NULL or network_addr->version is SX_IP_VERSION_NONE
  *  then all IPv4 routes of the specified type are deleted.
+ *  To replace the whole table of a virtual router without deleting the routes first,
+ *  see sx_api_router_uc_route_refresh_set.
  *  For routes with action TRAP or TRAP_FORWARD, the trapped traffic will
  *  have Trap ID of SX_TRAP_ID_L3_UC_IP_BASE + trap priority in SwitchX/SwitchX2;
  *  In Spectrum, the trap ID is SX_TRAP_ID_L3_UC_IP_BASE for trap priority BEST_EFFORT,
@@ -691,6 +835,95 @@ sx_status_t sx_api_router_uc_route_set(const sx_api_handle_t handle,
                                        const sx_ip_prefix_t *network_addr,
                                        sx_uc_route_data_t   *uc_route_data_p);
 
+/**
+ *  This function modifies a list of unicast routes in the routing table in
+ *  a single call. Each entry i is the tuple (vrid_list_p[i], network_addr_list_p[i],
+ *  uc_route_data_list_p[i]) and is handled exactly as by sx_api_router_uc_route_set
+ *  with the same cmd.
+ *  Entries are processed in list order. A failure on one entry does not stop the
+ *  processing of the following entries; the result of every entry is returned in
+ *  status_list_p[i].
+ *  On return, *route_cnt_p holds the number of entries which were programmed
+ *  successfully. If it is smaller than the given count, SX_STATUS_PARTIALLY_COMPLETE
+ *  is returned and status_list_p should be scanned for the failed entries.
+ *  Command DELETE_ALL is not supported by this function, use sx_api_router_uc_route_set.
+ *  For command SOFT_ADD, uc_route_data_list_p[i] returns the actual set of next-hops
+ *  used in hardware, as for sx_api_router_uc_route_set.
+ *
+ *  Supported devices: Spectrum.
+ *
+ * @param[in] handle - SX-API handle.
+ * @param[in] cmd - ADD/SET/SOFT_ADD/DELETE
+ * @param[in] vrid_list_p - list of Virtual Router IDs.
+ * @param[in] network_addr_list_p - list of IP network addresses.
+ * @param[in,out] uc_route_data_list_p - list of route data {Next hop list,action}
+ * @param[out] status_list_p - per-entry operation status.
+ * @param[in,out] route_cnt_p - [in] number of entries in the lists /
+ *                              [out] number of entries programmed successfully.
+ *
+ * @return SX_STATUS_SUCCESS if all entries were programmed successfully.
+ * @return SX_STATUS_PARTIALLY_COMPLETE if some of the entries failed.
+ * @return SX_STATUS_CMD_UNSUPPORTED if access command isn't supported.
+ * @return SX_STATUS_PARAM_NULL if any list parameter is NULL.
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if *route_cnt_p is 0 or exceeds range.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_uc_route_bulk_set(const sx_api_handle_t handle,
+                                            const sx_access_cmd_t cmd,
+                                            const sx_router_id_t *vrid_list_p,
+                                            const sx_ip_prefix_t *network_addr_list_p,
+                                            sx_uc_route_data_t   *uc_route_data_list_p,
+                                            sx_status_t          *status_list_p,
+                                            uint32_t             *route_cnt_p);
+
+/**
+ *  This function replaces the unicast routing table of a virtual router in mark-and-sweep mode.
+ *  Command CREATE (mark) starts a refresh of the routes of vrid whose IP version is ip_version
+ *  and whose type is route_type, as selected by DELETE_ALL of sx_api_router_uc_route_set:
+ *  all these routes are marked stale, and *route_cnt_p returns their number. Routes of other
+ *  types (e.g. IP2ME and LOCAL routes when refreshing NEXT_HOP routes) are not part of the
+ *  refresh and are never deleted by the sweep. Traffic keeps being forwarded by the stale
+ *  routes.
+ *  While a refresh is running, a route of this vrid, IP version and type which is given again to
+ *  sx_api_router_uc_route_set or sx_api_router_uc_route_bulk_set with command ADD, SET or
+ *  SOFT_ADD is marked fresh, and its route data is replaced by the given data as with
+ *  command SET: ADD does not merge the given next hops into the existing next-hop set, so
+ *  next hops which are not given again are removed. SOFT_ADD also returns the next hops
+ *  as written on HW. If the route data is unchanged, no hardware write is done; otherwise
+ *  the route is modified in place.
+ *  Command DELETE (sweep) deletes all routes which are still stale, ends the refresh, and
+ *  *route_cnt_p returns the number of deleted routes. Only routes that were added, modified
+ *  or deleted during the refresh are written to the hardware.
+ *  Command DESTROY ends the refresh without deleting any route.
+ *  Only one refresh may run per vrid, IP version and route type.
+ *  A refresh belongs to the handle which created it: DELETE and DESTROY must be called on
+ *  the same handle, and the refresh is ended implicitly, as by DESTROY, when the handle is
+ *  closed. Stale routes are then kept, and ADD returns to its usual behavior.
+ *
+ *  Supported devices: Spectrum.
+ *
+ * @param[in] handle - SX-API handle.
+ * @param[in] cmd - CREATE/DELETE/DESTROY
+ * @param[in] vrid - Virtual Router ID.
+ * @param[in] ip_version - IP version of the routes to refresh.
+ * @param[in] route_type - type of the routes to refresh.
+ * @param[out] route_cnt_p - number of routes marked stale (CREATE) or deleted (DELETE) (may be NULL).
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully.
+ * @return SX_STATUS_CMD_UNSUPPORTED if access command isn't supported.
+ * @return SX_STATUS_PARAM_ERROR if any input parameter is invalid.
+ * @return SX_STATUS_ENTRY_NOT_FOUND if vrid does not exist, or no refresh created by this handle
+ *         is running (DELETE/DESTROY).
+ * @return SX_STATUS_RESOURCE_IN_USE if a refresh is already running (CREATE).
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_uc_route_refresh_set(const sx_api_handle_t    handle,
+                                               const sx_access_cmd_t    cmd,
+                                               const sx_router_id_t     vrid,
+                                               const sx_ip_version_t    ip_version,
+                                               const sx_uc_route_type_e route_type,
+                                               uint32_t                *route_cnt_p);
+
 /**
  *  This function gets unicast route information from the routing table.
  *  The function can receive four types of input:
@@ -742,6 +975,136 @@ sx_status_t sx_api_router_uc_route_get(const sx_api_handle_t     handle,
                                        sx_uc_route_get_entry_t  *uc_route_get_entries_list_p,
                                        uint32_t                 *uc_route_get_entries_cnt_p);
 
+/**
+ *  This function creates/destroys a unicast route dump cursor.
+ *  A cursor walks all unicast routes of a virtual router in the same order as
+ *  GET_FIRST/GETNEXT of sx_api_router_uc_route_get, and keeps its position inside
+ *  the SDK, so that no key has to be passed back on every call.
+ *  Command CREATE opens a new cursor positioned before the first route of vrid
+ *  whose IP version matches network_addr_p->version, and returns its ID in cursor_id_p.
+ *  Routes are filtered according to filter_p, as in sx_api_router_uc_route_get.
+ *  Command DESTROY closes the cursor given in cursor_id_p. A cursor must be
+ *  destroyed by the same handle which created it, and is destroyed implicitly
+ *  when the handle is closed.
+ *  Routes added or deleted while a cursor is open are returned only if their
+ *  position is after the current cursor position.
+ *
+ *  Supported devices: SwitchX, SwitchX2, Spectrum.
+ *
+ * @param[in] handle - SX-API handle.
+ * @param[in] cmd - CREATE/DESTROY.
+ * @param[in] vrid - Virtual Router ID. Applicable only for command CREATE.
+ * @param[in] network_addr_p - IP version to dump. Applicable only for command CREATE.
+ * @param[in] filter_p - UC route key_filter (may be NULL). Applicable only for command CREATE.
+ * @param[in,out] cursor_id_p - cursor ID. Returned on CREATE, given on DESTROY.
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully.
+ * @return SX_STATUS_CMD_UNSUPPORTED if access command isn't supported.
+ * @return SX_STATUS_PARAM_NULL if any input parameter is NULL.
+ * @return SX_STATUS_PARAM_ERROR if any input parameter is invalid.
+ * @return SX_STATUS_ENTRY_NOT_FOUND if the cursor does not exist.
+ * @return SX_STATUS_NO_RESOURCES if no more cursors can be opened.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_uc_route_cursor_set(const sx_api_handle_t           handle,
+                                              const sx_access_cmd_t           cmd,
+                                              const sx_router_id_t            vrid,
+                                              const sx_ip_prefix_t           *network_addr_p,
+                                              const sx_uc_route_key_filter_t *filter_p,
+                                              uint32_t                       *cursor_id_p);
+
+/**
+ *  This function retrieves the next page of unicast routes from a dump cursor
+ *  opened by sx_api_router_uc_route_cursor_set, and advances the cursor.
+ *  Unlike GETNEXT of sx_api_router_uc_route_get, the page size is not limited to
+ *  64 entries; it is bounded only by the size of the caller-provided list.
+ *  When the cursor reaches the end of the table, *uc_route_get_entries_cnt_p is
+ *  set to the number of entries returned in the last page (possibly 0), and
+ *  SX_STATUS_ENTRY_NOT_FOUND is returned on any further call.
+ *
+ *  Supported devices: SwitchX, SwitchX2, Spectrum.
+ *
+ * @param[in] handle - SX-API handle.
+ * @param[in] cursor_id - cursor ID returned by sx_api_router_uc_route_cursor_set.
+ * @param[out] uc_route_get_entries_list_p - found uc route entries arr.
+ * @param[in,out] uc_route_get_entries_cnt_p - [in] size of uc_route_get_entries_list_p /
+ *                                             [out] number of entries returned.
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully.
+ * @return SX_STATUS_PARAM_NULL if any input parameter is NULL.
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if *uc_route_get_entries_cnt_p is 0.
+ * @return SX_STATUS_ENTRY_NOT_FOUND if the cursor does not exist or has no more routes.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_uc_route_cursor_get(const sx_api_handle_t    handle,
+                                              const uint32_t           cursor_id,
+                                              sx_uc_route_get_entry_t *uc_route_get_entries_list_p,
+                                              uint32_t                *uc_route_get_entries_cnt_p);
+
+/**
+ *  This function retrieves the memory used by the SDK unicast route database of a
+ *  virtual router.
+ *  memory_size_p returns the bytes of SDK memory used to store the routes of the given
+ *  vrid and IP version and their route data. The memory per route is
+ *  *memory_size_p / *route_cnt_p.
+ *  route_data_cnt_p returns the number of distinct route data (next hop list and
+ *  action) among these routes.
+ *
+ *  Supported devices: SwitchX, SwitchX2, Spectrum.
+ *
+ * @param[in] handle - SX-API handle.
+ * @param[in] vrid - Virtual Router ID.
+ * @param[in] ip_version - IP version.
+ * @param[out] route_cnt_p - number of routes in the database.
+ * @param[out] route_data_cnt_p - number of distinct route data entries (may be NULL).
+ * @param[out] memory_size_p - memory used by the database, in bytes.
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully.
+ * @return SX_STATUS_PARAM_NULL if any input parameter is NULL.
+ * @return SX_STATUS_PARAM_ERROR if any input parameter is invalid.
+ * @return SX_STATUS_ENTRY_NOT_FOUND if vrid does not exist.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_uc_route_db_memory_get(const sx_api_handle_t handle,
+                                                 const sx_router_id_t  vrid,
+                                                 const sx_ip_version_t ip_version,
+                                                 uint32_t             *route_cnt_p,
+                                                 uint32_t             *route_data_cnt_p,
+                                                 uint64_t             *memory_size_p);
+
+/**
+ *  This function performs a longest prefix match lookup of a list of IP addresses in
+ *  the unicast routing table of a virtual router, as held by the SDK route database.
+ *  For each address ip_addr_list_p[i], the most specific route covering it is returned in
+ *  uc_route_get_entries_list_p[i], in the same form as sx_api_router_uc_route_get, and
+ *  status_list_p[i] is set to SX_STATUS_SUCCESS. If no route covers the address,
+ *  status_list_p[i] is set to SX_STATUS_ENTRY_NOT_FOUND and the entry is not modified.
+ *  Addresses may be of mixed IP versions. A single address lookup uses addr_cnt = 1.
+ *  The lookup is done on the SDK database and does not access the hardware; the result
+ *  reflects all completed calls to sx_api_router_uc_route_set.
+ *
+ *  Supported devices: SwitchX, SwitchX2, Spectrum.
+ *
+ * @param[in] handle - SX-API handle.
+ * @param[in] vrid - Virtual Router ID.
+ * @param[in] ip_addr_list_p - list of IP addresses to look up.
+ * @param[out] uc_route_get_entries_list_p - matching uc route entries arr.
+ * @param[out] status_list_p - per-address lookup status.
+ * @param[in] addr_cnt - number of addresses in ip_addr_list_p.
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully.
+ * @return SX_STATUS_PARAM_NULL if any input parameter is NULL.
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if addr_cnt is 0 or exceeds range.
+ * @return SX_STATUS_ENTRY_NOT_FOUND if vrid does not exist.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_uc_route_lpm_get(const sx_api_handle_t    handle,
+                                           const sx_router_id_t     vrid,
+                                           const sx_ip_addr_t      *ip_addr_list_p,
+                                           sx_uc_route_get_entry_t *uc_route_get_entries_list_p,
+                                           sx_status_t             *status_list_p,
+                                           const uint32_t           addr_cnt);
+
 /**
  *  This function retrieves active unicast ECMP route information from the routing table.
  *  When using oper_uc_route_entries_p->route_data.next_hop_cnt=0 only the number of next hops will be returned.
@@ -763,6 +1126,36 @@ sx_status_t sx_api_router_uc_route_operational_ecmp_get(const sx_api_handle_t
                                                         const sx_ip_prefix_t    *network_addr_p,
                                                         sx_uc_route_get_entry_t *oper_uc_route_entries_p);
 
+/**
+ *  This function retrieves the next page of unicast routes from a dump cursor opened by
+ *  sx_api_router_uc_route_cursor_set, with their active next hops, and advances the cursor.
+ *  Each returned entry holds the next hops as written on HW, in the same form as
+ *  sx_api_router_uc_route_operational_ecmp_get, instead of the next hops configured by
+ *  the user. Routes of other types are returned as by sx_api_router_uc_route_cursor_get.
+ *  The SDK keeps only the cursor position between calls, so the memory used by a dump
+ *  does not depend on the size of the table.
+ *  When the cursor reaches the end of the table, *oper_uc_route_entries_cnt_p is set to the
+ *  number of entries returned in the last page (possibly 0), and SX_STATUS_ENTRY_NOT_FOUND
+ *  is returned on any further call.
+ *  Supported devices: Spectrum.
+ *
+ * @param[in] handle - SX-API handle.
+ * @param[in] cursor_id - cursor ID returned by sx_api_router_uc_route_cursor_set.
+ * @param[out] oper_uc_route_entries_list_p - found uc route entries arr.
+ * @param[in,out] oper_uc_route_entries_cnt_p - [in] size of oper_uc_route_entries_list_p /
+ *                                              [out] number of entries returned.
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully.
+ * @return SX_STATUS_PARAM_NULL if any input parameter is NULL.
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if *oper_uc_route_entries_cnt_p is 0.
+ * @return SX_STATUS_ENTRY_NOT_FOUND if the cursor does not exist or has no more routes.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_uc_route_operational_ecmp_cursor_get(const sx_api_handle_t    handle,
+                                                               const uint32_t           cursor_id,
+                                                               sx_uc_route_get_entry_t *oper_uc_route_entries_list_p,
+                                                               uint32_t                *oper_uc_route_entries_cnt_p);
+
 /**
  *  Binds or un-binds a flow counter to an existing unicast route
  *  Note: A route may be created via a call to sx_api_router_uc_route_set()
@@ -810,6 +1203,72 @@ sx_status_t sx_api_router_uc_route_counter_bind_get(const sx_api_handle_t handle
                                                     const sx_ip_prefix_t *network_addr_p,
                                                     sx_flow_counter_id_t *counter_id_p);
 
+/**
+ *  Binds or un-binds flow counters to a list of existing unicast routes in a single call
+ *  Each entry i binds counter_id_list_p[i] to the route (vrid_list_p[i], network_addr_list_p[i]),
+ *  or un-binds the counter of that route, exactly as sx_api_router_uc_route_counter_bind_set.
+ *  The result of every entry is returned in status_list_p[i].
+ *  Supported devices: Spectrum.
+ *
+ * @param[in] handle - SX-API handle
+ * @param[in] cmd - BIND/UNBIND
+ * @param[in] vrid_list_p - list of Virtual Router IDs
+ * @param[in] network_addr_list_p - list of network prefixes of unicast routes
+ * @param[in] counter_id_list_p - list of flow counter identifiers. Applicable only for command BIND
+ * @param[out] status_list_p - per-entry operation status
+ * @param[in] route_cnt - number of entries in the lists
+ *
+ * @return SX_STATUS_SUCCESS if all entries completed successfully.
+ * @return SX_STATUS_PARTIALLY_COMPLETE if some of the entries failed.
+ * @return SX_STATUS_CMD_UNSUPPORTED if access command isn't supported.
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if route_cnt is 0 or exceeds range.
+ * @return SX_STATUS_PARAM_NULL if any list parameter is NULL.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_uc_route_counter_bind_bulk_set(const sx_api_handle_t       handle,
+                                                         const sx_access_cmd_t       cmd,
+                                                         const sx_router_id_t       *vrid_list_p,
+                                                         const sx_ip_prefix_t       *network_addr_list_p,
+                                                         const sx_flow_counter_id_t *counter_id_list_p,
+                                                         sx_status_t                *status_list_p,
+                                                         const uint32_t              route_cnt);
+
+/**
+ *  Retrieves the flow counters currently bound to a list of unicast routes, and optionally
+ *  reads their values in the same call
+ *  counter_id_list_p[i] returns the flow counter bound to (vrid_list_p[i], network_addr_list_p[i]),
+ *  or SX_FLOW_COUNTER_ID_INVALID if no counter is bound to it.
+ *  If counter_set_list_p is not NULL, counter_set_list_p[i] also returns the values of that
+ *  counter, as sx_api_flow_counter_get with the same cmd. Counters are read from the hardware
+ *  in one bulk counter transaction.
+ *  The result of every entry is returned in status_list_p[i].
+ *  Supported devices: Spectrum.
+ *
+ * @param[in] handle - SX-API handle
+ * @param[in] cmd - READ/READ_CLEAR. Applicable only if counter_set_list_p is not NULL
+ * @param[in] vrid_list_p - list of Virtual Router IDs
+ * @param[in] network_addr_list_p - list of network prefixes of unicast routes
+ * @param[out] counter_id_list_p - list of flow counter IDs bound to the routes
+ * @param[out] counter_set_list_p - list of flow counter values (may be NULL)
+ * @param[out] status_list_p - per-entry operation status
+ * @param[in] route_cnt - number of entries in the lists
+ *
+ * @return SX_STATUS_SUCCESS if all entries completed successfully.
+ * @return SX_STATUS_PARTIALLY_COMPLETE if some of the entries failed.
+ * @return SX_STATUS_CMD_UNSUPPORTED if access command isn't supported.
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if route_cnt is 0 or exceeds range.
+ * @return SX_STATUS_PARAM_NULL if any list parameter is NULL.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_uc_route_counter_bind_bulk_get(const sx_api_handle_t  handle,
+                                                         const sx_access_cmd_t  cmd,
+                                                         const sx_router_id_t  *vrid_list_p,
+                                                         const sx_ip_prefix_t  *network_addr_list_p,
+                                                         sx_flow_counter_id_t  *counter_id_list_p,
+                                                         sx_flow_counter_set_t *counter_set_list_p,
+                                                         sx_status_t           *status_list_p,
+                                                         const uint32_t         route_cnt);
+
 /**
  *  This function creates/destroys a router counter. A router counter
  *  should be bound later to a router interface.
@@ -933,6 +1392,66 @@ sx_status_t sx_api_router_counter_extended_get(const sx_api_handle_t
                                                const sx_access_cmd_t             cmd,
                                                const sx_router_counter_id_t      counter_id,
                                                sx_router_counter_set_extended_t *counter_data_p);
+
+/**
+ *  This function gets a list of router counters in a single call.
+ *  counter_set_list_p[i] returns the values of counter_id_list_p[i], as returned by
+ *  sx_api_router_counter_get. All counters are read from the hardware in one bulk
+ *  counter transaction, so the values of all counters are taken at the same time.
+ *  When using cmd=READ_CLEAR, the counters will be returned and cleared.
+ *  If a counter ID does not exist, status_list_p[i] is set to SX_STATUS_ENTRY_NOT_FOUND
+ *  and the other counters are still read.
+ *  Supported devices: SwitchX, SwitchX2, Spectrum.
+ *
+ * @param[in] handle - SX-API handle.
+ * @param[in] cmd - READ/READ_CLEAR
+ * @param[in] counter_id_list_p - list of Router counter IDs.
+ * @param[out] counter_set_list_p - list of Router counter set values.
+ * @param[out] status_list_p - per-counter read status.
+ * @param[in] counter_cnt - number of counters in counter_id_list_p.
+ *
+ * @return SX_STATUS_SUCCESS if all counters were read successfully.
+ * @return SX_STATUS_PARTIALLY_COMPLETE if some of the counters were not found.
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if counter_cnt is 0 or exceeds range.
+ * @return SX_STATUS_PARAM_NULL if parameter is NULL.
+ * @return SX_STATUS_PARAM_ERROR if any input parameter is invalid.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_counter_bulk_get(const sx_api_handle_t         handle,
+                                           const sx_access_cmd_t         cmd,
+                                           const sx_router_counter_id_t *counter_id_list_p,
+                                           sx_router_counter_set_t      *counter_set_list_p,
+                                           sx_status_t                  *status_list_p,
+                                           const uint32_t                counter_cnt);
+
+/**
+ *  This function gets a list of router counters by given type in a single call.
+ *  It is the extended form of sx_api_router_counter_bulk_get, and returns the same
+ *  values as sx_api_router_counter_extended_get.
+ *  When using cmd=READ_CLEAR, the counters will be returned and cleared.
+ *  Supported devices: Spectrum.
+ *
+ * @param[in] handle - SX-API handle.
+ * @param[in] cmd - READ/READ_CLEAR
+ * @param[in] counter_id_list_p - list of Router counter IDs.
+ * @param[out] counter_data_list_p - list of Router counter data values.
+ * @param[out] status_list_p - per-counter read status.
+ * @param[in] counter_cnt - number of counters in counter_id_list_p.
+ *
+ * @return SX_STATUS_SUCCESS if all counters were read successfully.
+ * @return SX_STATUS_PARTIALLY_COMPLETE if some of the counters were not found.
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if counter_cnt is 0 or exceeds range.
+ * @return SX_STATUS_PARAM_NULL if parameter is NULL.
+ * @return SX_STATUS_PARAM_ERROR if any input parameter is invalid.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_counter_extended_bulk_get(const sx_api_handle_t             handle,
+                                                    const sx_access_cmd_t             cmd,
+                                                    const sx_router_counter_id_t     *counter_id_list_p,
+                                                    sx_router_counter_set_extended_t *counter_data_list_p,
+                                                    sx_status_t                      *status_list_p,
+                                                    const uint32_t                    counter_cnt);
+
 /**
  *  This function clears router counter set of a router counter.
  *  Supported devices: SwitchX, SwitchX2, Spectrum.
@@ -968,6 +1487,8 @@ sx_status_t sx_api_router_counter_clear_set(const sx_api_handle_t        handle,
  * Multicast containers are valid on Spectrum only.
  * egress_rif_cnt and egress_container_id are mutually exclusive and may not be both specified.
  * e.g. if egress_rif_cnt is nonzero then egress_container_id must be SX_MC_CONTAINER_ID_INVALID.
+ * egress_container_id must be a container created by sx_api_mc_container_set. Containers
+ * owned by the SDK (see sx_api_fdb_mc_mac_addr_group_port_set) cannot be used.
  * The DELETE_ALL command will delete all MC routes that match a given VRID and
  * IP version specified by source_addr.version. If the given IP version is SX_IP_VERSION_NONE,
  * then all MC routes on the given VRID will be deleted, regardless of the IP version.
@@ -991,7 +1512,8 @@ sx_status_t sx_api_router_counter_clear_set(const sx_api_handle_t        handle,
  * @return SX_STATUS_SUCCESS if operation completes successfully.
  * @return SX_STATUS_CMD_UNSUPPORTED if access command isn't supported.
  * @return SX_STATUS_PARAM_EXCEEDS_RANGE if parameters exceed range.
- * @return SX_STATUS_PARAM_ERROR if any input parameter is invalid.
+ * @return SX_STATUS_PARAM_ERROR if any input parameter is invalid, or if egress_container_id
+ *         is a container owned by the SDK.
  * @return SX_STATUS_NO_RESOURCES if no routes are available to create.
  * @return SX_STATUS_ERROR general error.
  */
@@ -1002,6 +1524,48 @@ sx_status_t sx_api_router_mc_route_set(const sx_api_handle_t            handle,
                                        const sx_mc_route_attributes_t * mc_route_attr_p,
                                        const sx_mc_route_data_t       * mc_route_data_p);
 
+/**
+ * This function adds/modifies/deletes a list of multicast routes in a single call.
+ * Each entry i is the tuple (mc_route_key_list_p[i], mc_route_attr_list_p[i],
+ * mc_route_data_list_p[i]) and is handled exactly as by sx_api_router_mc_route_set
+ * with the same cmd and vrid. Both (S,G) and (*,G) keys may be given in one list.
+ * To share an egress list between routes, create it once with sx_api_mc_container_set
+ * and reference it by egress_container_id in the route data of every route; the
+ * container is programmed once, and a change to it applies to all routes using it.
+ * Entries are processed in list order. A failure on one entry does not stop the
+ * processing of the following entries; the result of every entry is returned in
+ * status_list_p[i].
+ * On return, *mc_route_cnt_p holds the number of entries which were programmed successfully.
+ * Command DELETE_ALL is not supported by this function, use sx_api_router_mc_route_set.
+ *
+ * Supported devices: Spectrum.
+ *
+ * @param[in] handle - SX-API handle.
+ * @param[in] cmd - ADD/EDIT/DELETE
+ * @param[in] vrid - Virtual Router ID.
+ * @param[in] mc_route_key_list_p - list of mc route entry keys
+ * @param[in] mc_route_attr_list_p - list of multicast route attributes. Ignored for DELETE (may be NULL).
+ * @param[in] mc_route_data_list_p - list of route data. Ignored for DELETE (may be NULL).
+ * @param[out] status_list_p - per-entry operation status.
+ * @param[in,out] mc_route_cnt_p - [in] number of entries in the lists /
+ *                                 [out] number of entries programmed successfully.
+ *
+ * @return SX_STATUS_SUCCESS if all entries were programmed successfully.
+ * @return SX_STATUS_PARTIALLY_COMPLETE if some of the entries failed.
+ * @return SX_STATUS_CMD_UNSUPPORTED if access command isn't supported.
+ * @return SX_STATUS_PARAM_NULL if any list parameter is NULL.
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if *mc_route_cnt_p is 0 or exceeds range.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_mc_route_bulk_set(const sx_api_handle_t           handle,
+                                            const sx_access_cmd_t           cmd,
+                                            const sx_router_id_t            vrid,
+                                            const sx_mc_route_key_t        *mc_route_key_list_p,
+                                            const sx_mc_route_attributes_t *mc_route_attr_list_p,
+                                            const sx_mc_route_data_t       *mc_route_data_list_p,
+                                            sx_status_t                    *status_list_p,
+                                            uint32_t                       *mc_route_cnt_p);
+
 /**
  * This function gets a multicast route or routes from the MC routing table,
  * based on a given key or criteria.
@@ -1058,6 +1622,64 @@ sx_status_t sx_api_router_mc_route_get(const sx_api_handle_t     handle,
                                        sx_mc_route_get_entry_t  *mc_route_get_entries_list_p,
                                        uint32_t                 *mc_route_get_entries_cnt_p);
 
+/**
+ * This function creates/destroys a multicast route dump cursor.
+ * A cursor walks the MC routes of a virtual router in the same order as GET_FIRST/GET_NEXT
+ * of sx_api_router_mc_route_get, and keeps its position inside the SDK.
+ * Command CREATE opens a new cursor positioned before the first route of vrid matching
+ * filter_p, and returns its ID in cursor_id_p.
+ * Command DESTROY closes the cursor given in cursor_id_p. A cursor is destroyed
+ * implicitly when the handle which created it is closed.
+ *
+ * Supported devices: Spectrum.
+ *
+ * @param[in] handle - SX-API handle.
+ * @param[in] cmd - CREATE/DESTROY.
+ * @param[in] vrid - Virtual Router ID. Applicable only for command CREATE.
+ * @param[in] filter_p - MC route key filter (may be NULL). Applicable only for command CREATE.
+ * @param[in,out] cursor_id_p - cursor ID. Returned on CREATE, given on DESTROY.
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully.
+ * @return SX_STATUS_CMD_UNSUPPORTED if access command isn't supported.
+ * @return SX_STATUS_PARAM_NULL if any input parameter is NULL.
+ * @return SX_STATUS_ENTRY_NOT_FOUND if the cursor does not exist.
+ * @return SX_STATUS_NO_RESOURCES if no more cursors can be opened.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_mc_route_cursor_set(const sx_api_handle_t           handle,
+                                              const sx_access_cmd_t           cmd,
+                                              const sx_router_id_t            vrid,
+                                              const sx_mc_route_key_filter_t *filter_p,
+                                              uint32_t                       *cursor_id_p);
+
+/**
+ * This function retrieves the next page of multicast routes from a dump cursor opened by
+ * sx_api_router_mc_route_cursor_set, and advances the cursor.
+ * The page size is not limited by SX_API_MC_ROUTE_GET_MAX_COUNT; it is bounded only by
+ * the size of the caller-provided list.
+ * When the cursor reaches the end of the table, *mc_route_get_entries_cnt_p is set to the
+ * number of entries returned in the last page (possibly 0), and SX_STATUS_ENTRY_NOT_FOUND
+ * is returned on any further call.
+ *
+ * Supported devices: Spectrum.
+ *
+ * @param[in] handle - SX-API handle.
+ * @param[in] cursor_id - cursor ID returned by sx_api_router_mc_route_cursor_set.
+ * @param[out] mc_route_get_entries_list_p - list of returned MC routes
+ * @param[in,out] mc_route_get_entries_cnt_p - [in] number of entries in mc_route_get_entries_list_p /
+ *                                             [out] number of entries returned.
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully.
+ * @return SX_STATUS_PARAM_NULL if any input parameter is NULL.
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if *mc_route_get_entries_cnt_p is 0.
+ * @return SX_STATUS_ENTRY_NOT_FOUND if the cursor does not exist or has no more routes.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_mc_route_cursor_get(const sx_api_handle_t    handle,
+                                              const uint32_t           cursor_id,
+                                              sx_mc_route_get_entry_t *mc_route_get_entries_list_p,
+                                              uint32_t                *mc_route_get_entries_cnt_p);
+
 /**
  *  This function reads and clears multicast route activity.
  *  Supported devices: SwitchX, SwitchX2, Spectrum.
@@ -1096,6 +1718,64 @@ sx_status_t sx_api_router_mc_route_activity_get(const sx_api_handle_t     handle
 sx_status_t sx_api_router_mc_route_activity_notify(const sx_api_handle_t                       handle,
                                                    const sx_access_cmd_t                       cmd,
                                                    const sx_mc_route_activity_notify_filter_t *filter_p);
+
+/**
+ * This function enables/disables the persistent multicast route activity tracker.
+ * While the tracker is enabled, the SDK keeps an idle timer per MC route matching
+ * filter_p. A route becomes idle when no traffic hit it for stream_params_p->idle_time
+ * seconds, and becomes active again on its next hit. Only these state changes are
+ * reported, in batches of up to stream_params_p->max_batch_size entries, as events with
+ * trap ID SX_TRAP_ID_ROUTER_MC_ACTIVITY_CHANGE, which can be read with
+ * sx_lib_host_ifc_recv_list on a file descriptor registered to this trap ID.
+ * stream_params_p->scan_budget bounds the number of routes scanned per sweep slice.
+ * While the tracker is enabled, sx_api_router_mc_route_activity_notify returns
+ * SX_STATUS_RESOURCE_IN_USE.
+ *
+ * stream_params_p (sx_mc_route_activity_stream_params_t) holds:
+ *  - idle_time      - uint32_t, idle time in seconds, 1 to 86400
+ *  - scan_budget    - uint32_t, maximum number of routes scanned per sweep slice, 1 to 65536
+ *  - max_batch_size - uint32_t, maximum number of changes per event, 1 to
+ *                     SX_MC_ROUTE_ACTIVITY_BATCH_MAX (64)
+ * Each event (sx_mc_route_activity_event_t, in receive_info->event_info.mc_route_activity)
+ * holds entry_cnt and a list of entries {vrid, mc_route_key, active}, where active is TRUE
+ * when the route became active and FALSE when it became idle.
+ *  Supported devices: Spectrum.
+ *
+ * @param[in] handle          - SX-API handle
+ * @param[in] cmd             - ENABLE\DISABLE
+ * @param[in] filter_p        - activity notifier filter. Applicable only for command ENABLE
+ * @param[in] stream_params_p - idle time, scan budget and batch size. Applicable only for command ENABLE
+ *
+ * @return SX_STATUS_SUCCESS             if operation completes successfully.
+ * @return SX_STATUS_CMD_UNSUPPORTED     if access command isn't supported.
+ * @return SX_STATUS_PARAM_NULL          if parameter is NULL.
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if a parameter exceeds its range.
+ * @return SX_STATUS_RESOURCE_IN_USE     if a notification procedure is already running.
+ * @return SX_STATUS_ERROR               general error.
+ */
+sx_status_t sx_api_router_mc_route_activity_stream_set(const sx_api_handle_t                       handle,
+                                                       const sx_access_cmd_t                       cmd,
+                                                       const sx_mc_route_activity_notify_filter_t *filter_p,
+                                                       const sx_mc_route_activity_stream_params_t *stream_params_p);
+
+/**
+ * This function retrieves the state and parameters of the multicast route activity tracker.
+ *  Supported devices: Spectrum.
+ *
+ * @param[in] handle           - SX-API handle
+ * @param[out] enabled_p       - TRUE if the tracker is enabled
+ * @param[out] filter_p        - activity notifier filter
+ * @param[out] stream_params_p - idle time, scan budget and batch size
+ *
+ * @return SX_STATUS_SUCCESS             if operation completes successfully.
+ * @return SX_STATUS_PARAM_NULL          if parameter is NULL.
+ * @return SX_STATUS_ERROR               general error.
+ */
+sx_status_t sx_api_router_mc_route_activity_stream_get(const sx_api_handle_t                 handle,
+                                                       boolean_t                            *enabled_p,
+                                                       sx_mc_route_activity_notify_filter_t *filter_p,
+                                                       sx_mc_route_activity_stream_params_t *stream_params_p);
+
 /**
  *  This function adds/sets/deletes/deletes-all egress RIFs to/from a previously
  *  configured MC route.
@@ -1280,6 +1960,22 @@ sx_status_t sx_api_router_cos_dscp_to_prio_get(const sx_api_handle_t    handle,
  * and new container ID.
  * SX_ACCESS_CMD_SET - Modifies the contents of an existing ECMP container,
  * specified by *ecmp_id_p. If *next_hop_cnt_p is zero, empties the container.
+ * SX_ACCESS_CMD_ADD - Adds the given next hops to an existing ECMP container,
+ * specified by *ecmp_id_p. Next hops already in the container are left unchanged.
+ * SX_ACCESS_CMD_DELETE - Deletes the given next hops from an existing ECMP
+ * container, specified by *ecmp_id_p. Deleting the last next hop of a container
+ * in use by UC route(s) is not allowed.
+ * ADD and DELETE update the container in place, without allocating a second
+ * container.
+ * For containers of type SX_ECMP_TYPE_RESILIENT_E (see sx_api_router_ecmp_attributes_set),
+ * the hash buckets of surviving next hops are kept: DELETE redistributes only the
+ * buckets of the deleted next hops, and ADD moves to the new next hops the smallest
+ * number of buckets needed to reach their weight. Only the moved buckets are written
+ * to HW, and flows hashed to surviving next hops are not moved.
+ * For other container types the next hops are re-spread and the container is
+ * rewritten as for SET.
+ * For ADD and DELETE, next_hop_list_p and *next_hop_cnt_p are not modified; the
+ * resulting content may be read with sx_api_router_operational_ecmp_get.
  * SX_ACCESS_CMD_DESTROY - by providing a container ID, the command removes
  * all next hops from the existing given container, destroying the container as well.
  * The container ID is invalid until reassigned on container creation. This command
@@ -1291,7 +1987,7 @@ sx_status_t sx_api_router_cos_dscp_to_prio_get(const sx_api_handle_t    handle,
  * case container is in use by UC route(s).
  *
  * @param[in] handle                 - SX-API handle
- * @param[in] cmd                    - action to perform: CREATE, DESTROY, SET,
+ * @param[in] cmd                    - action to perform: CREATE, DESTROY, SET, ADD, DELETE
  * @param[in,out] ecmp_id            - id of ECMP container
  * @param[in,out] next_hop_list_p    - a given list of next hops
  * @param[in,out] next_hop_cnt_p     - amount of next hops
@@ -1301,8 +1997,14 @@ sx_status_t sx_api_router_cos_dscp_to_prio_get(const sx_api_handle_t    handle,
  * @return SX_STATUS_UNSUPPORTED         if invalid cmd.
  * @return SX_STATUS_NO_RESOURCES        if no space for ECMP container allocation.
  * @return SX_STATUS_RESOURCE_IN_USE     if trying to destroy ECMP an container
- *                                       in use.
- * @return SX_STATUS_ENTRY_NOT_FOUND     if ecmp_id not found.
+ *                                       in use, to DELETE the last next hop of a
+ *                                       container in use by UC route(s), or if
+ *                                       ecmp_id is a shared container
+ *                                       (see sx_api_router_ecmp_sharing_set).
+ * @return SX_STATUS_ENTRY_NOT_FOUND     if ecmp_id not found, or a next hop to
+ *                                       DELETE is not in the container.
+ * @return SX_STATUS_ENTRY_ALREADY_EXISTS if a next hop to ADD is already in the
+ *                                       container with a different weight.
  * @return SX_STATUS_ERROR               general error.
  */
 sx_status_t sx_api_router_ecmp_set(const sx_api_handle_t handle,
@@ -1311,6 +2013,60 @@ sx_status_t sx_api_router_ecmp_set(const sx_api_handle_t handle,
                                    sx_next_hop_t        *next_hop_list_p,
                                    uint32_t             *next_hop_cnt_p);
 
+/**
+ * This function enables/disables ECMP next hop set sharing.
+ * When sharing is enabled, the SDK interns the next hop sets of NEXT_HOP routes
+ * created by sx_api_router_uc_route_set with a list of next hop IPs: all routes of a
+ * VRID whose next hop sets are identical (same next hops and weights, in any order)
+ * share one internal ECMP container, instead of allocating an ECMP block per route.
+ * When the next hop set of a route changes, the route moves to the container of its new
+ * set, and a container is released when its last route is removed.
+ * Shared containers are listed by sx_api_router_ecmp_iter_get, and the number of routes
+ * using a shared container is returned by sx_api_object_refcount_get.
+ * Sharing may be changed only when no UC route with next hop IPs exists.
+ * Containers created by sx_api_router_ecmp_set are never shared.
+ * Shared containers are owned by the SDK and their content never changes while in use:
+ * sx_api_router_ecmp_set (any command) and sx_api_router_ecmp_attributes_set return
+ * SX_STATUS_RESOURCE_IN_USE for a shared container, and giving a shared container as
+ * ecmp_id of a route returns SX_STATUS_PARAM_ERROR.
+ *  Supported devices: Spectrum.
+ *
+ * @param[in] handle             - SX-API handle
+ * @param[in] cmd                - ENABLE/DISABLE
+ *
+ * @return SX_STATUS_SUCCESS             if operation completes successfully.
+ * @return SX_STATUS_CMD_UNSUPPORTED     if access command isn't supported.
+ * @return SX_STATUS_RESOURCE_IN_USE     if UC routes with next hop IPs exist.
+ * @return SX_STATUS_ERROR               general error.
+ */
+sx_status_t sx_api_router_ecmp_sharing_set(const sx_api_handle_t handle,
+                                           const sx_access_cmd_t cmd);
+
+/**
+ * This function retrieves the ECMP next hop set sharing state and usage.
+ * The number of ECMP containers saved by sharing is *route_cnt_p - *container_cnt_p.
+ * *entry_saved_cnt_p returns the number of ECMP table entries saved by sharing: for every
+ * shared container, its size in ECMP entries times the number of routes using it minus one.
+ * It is the amount by which the ECMP table usage reported by
+ * sx_api_rm_sdk_table_utilization_get would grow if sharing were disabled.
+ *  Supported devices: Spectrum.
+ *
+ * @param[in] handle             - SX-API handle
+ * @param[out] enabled_p         - TRUE if sharing is enabled
+ * @param[out] container_cnt_p   - number of shared ECMP containers in use (may be NULL)
+ * @param[out] route_cnt_p       - number of UC routes using shared ECMP containers (may be NULL)
+ * @param[out] entry_saved_cnt_p - number of ECMP table entries saved by sharing (may be NULL)
+ *
+ * @return SX_STATUS_SUCCESS             if operation completes successfully.
+ * @return SX_STATUS_PARAM_NULL          if enabled_p is NULL.
+ * @return SX_STATUS_ERROR               general error.
+ */
+sx_status_t sx_api_router_ecmp_sharing_get(const sx_api_handle_t handle,
+                                           boolean_t            *enabled_p,
+                                           uint32_t             *container_cnt_p,
+                                           uint32_t             *route_cnt_p,
+                                           uint32_t             *entry_saved_cnt_p);
+
 /**
  * This function retrieves an ECMP container content, as defined by the user.
  *  Supported devices: Spectrum.
@@ -1494,6 +2250,67 @@ sx_status_t sx_api_router_neigh_activity_notify(const sx_api_handle_t
                                                 const sx_access_cmd_t                    cmd,
                                                 const sx_router_neigh_activity_filter_t *filter_p);
 
+/**
+ * This function enables/disables the continuous neighbor activity stream.
+ * While the stream is enabled, the SDK sweeps the neighbors matching filter_p in
+ * the background and keeps a per-neighbor idle timer. Only neighbors whose state
+ * changed since the previous sweep are reported: a neighbor becomes idle when no
+ * activity was seen for stream_params_p->idle_time seconds, and becomes active again
+ * on its first activity.
+ * Changes are delivered in batches of up to stream_params_p->max_batch_size entries
+ * as events with trap ID SX_TRAP_ID_ROUTER_NEIGH_ACTIVITY_CHANGE, and can be read with
+ * sx_lib_host_ifc_recv_list on a file descriptor registered to this trap ID.
+ * stream_params_p->scan_budget bounds the number of neighbors scanned per sweep slice,
+ * so that a sweep does not delay other router API calls.
+ * While the stream is enabled, sx_api_router_neigh_activity_notify returns
+ * SX_STATUS_RESOURCE_IN_USE.
+ * Command ENABLE may be called again to update the filter and parameters of an enabled stream.
+ *
+ * stream_params_p (sx_router_neigh_activity_stream_params_t) holds:
+ *  - idle_time      - uint32_t, idle time in seconds, 1 to 86400
+ *  - scan_budget    - uint32_t, maximum number of neighbors scanned per sweep slice, 1 to 65536
+ *  - max_batch_size - uint32_t, maximum number of changes per event, 1 to
+ *                     SX_ROUTER_NEIGH_ACTIVITY_BATCH_MAX (64)
+ * Each event (sx_router_neigh_activity_event_t, in receive_info->event_info.neigh_activity)
+ * holds entry_cnt and a list of entries {rif, ip_addr, active}, where active is TRUE when
+ * the neighbor became active and FALSE when it became idle.
+ *  Supported devices: Spectrum.
+ *
+ * @param[in] handle          - SX-API handle
+ * @param[in] cmd             - ENABLE\DISABLE
+ * @param[in] filter_p        - neigh activity notifier filter. Applicable only for command ENABLE
+ * @param[in] stream_params_p - idle time, scan budget and batch size. Applicable only for command ENABLE
+ *
+ * @return SX_STATUS_SUCCESS             if operation completes successfully.
+ * @return SX_STATUS_CMD_UNSUPPORTED     if access command isn't supported.
+ * @return SX_STATUS_PARAM_NULL          if parameter is NULL.
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if a parameter exceeds its range.
+ * @return SX_STATUS_RESOURCE_IN_USE     if a notification procedure is already running.
+ * @return SX_STATUS_ERROR               general error.
+ */
+sx_status_t sx_api_router_neigh_activity_stream_set(const sx_api_handle_t                           handle,
+                                                    const sx_access_cmd_t                           cmd,
+                                                    const sx_router_neigh_activity_filter_t        *filter_p,
+                                                    const sx_router_neigh_activity_stream_params_t *stream_params_p);
+
+/**
+ * This function retrieves the state and parameters of the neighbor activity stream.
+ *  Supported devices: Spectrum.
+ *
+ * @param[in] handle           - SX-API handle
+ * @param[out] enabled_p       - TRUE if the stream is enabled
+ * @param[out] filter_p        - neigh activity notifier filter
+ * @param[out] stream_params_p - idle time, scan budget and batch size
+ *
+ * @return SX_STATUS_SUCCESS             if operation completes successfully.
+ * @return SX_STATUS_PARAM_NULL          if parameter is NULL.
+ * @return SX_STATUS_ERROR               general error.
+ */
+sx_status_t sx_api_router_neigh_activity_stream_get(const sx_api_handle_t                     handle,
+                                                    boolean_t                                *enabled_p,
+                                                    sx_router_neigh_activity_filter_t        *filter_p,
+                                                    sx_router_neigh_activity_stream_params_t *stream_params_p);
+
 /**
  *
  * This function sets an ECMP container's attributes.
@@ -1510,6 +2327,8 @@ sx_status_t sx_api_router_neigh_activity_notify(const sx_api_handle_t
  * @return SX_STATUS_ERROR                general error
  * @return SX_STATUS_PARAM_ERROR          if parameter is NULL or exceeds range.
  * @return SX_STATUS_ENTRY_NOT_FOUND      if ecmp_id not found.
+ * @return SX_STATUS_RESOURCE_IN_USE      if ecmp_id is a shared container
+ *                                        (see sx_api_router_ecmp_sharing_set).
  */
 sx_status_t sx_api_router_ecmp_attributes_set(const sx_api_handle_t       handle,
                                               const sx_ecmp_id_t          ecmp_id,